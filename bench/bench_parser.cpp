@@ -0,0 +1,112 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ast/arena.hpp"
+#include "front/parser.hpp"
+#include "front/scanner.hpp"
+
+using namespace arkoi;
+
+static constexpr size_t DEFAULT_FUNCTIONS = 100000;
+static constexpr size_t DEFAULT_ROUNDS = 7;
+
+static std::string generate_program(size_t functions) {
+    std::string data;
+
+    for (size_t index = 0; index < functions; index++) {
+        const auto name = "function_" + std::to_string(index);
+        data += "fun " + name + "(a@u64, b@u64) @u64:\n";
+        data += "    c@u64 = (a + b) * 3 - a / 2\n";
+        data += "    if c > 10:\n";
+        data += "        c = c + " + name + "(c - 1, b * 2)\n";
+        data += "    else:\n";
+        data += "        c = c - 1\n";
+        data += "    return c + a * b - 7\n\n";
+    }
+
+    return data;
+}
+
+static double median(std::vector<double> &timings) {
+    std::ranges::sort(timings);
+    return timings[timings.size() / 2];
+}
+
+int main(int argc, char *argv[]) {
+    const auto functions = (argc > 1 ? std::stoull(argv[1]) : DEFAULT_FUNCTIONS);
+    const auto rounds = (argc > 2 ? std::stoull(argv[2]) : DEFAULT_ROUNDS);
+
+    const auto data = generate_program(functions);
+
+    std::vector<double> parse_timings, teardown_timings;
+    size_t allocated = 0;
+
+    for (size_t round = 0; round < rounds; round++) {
+        const auto start = std::chrono::steady_clock::now();
+
+        auto arena = std::make_optional<ast::AstArena>();
+        DiagnosticEngine diagnostics;
+        front::Scanner scanner(data, diagnostics);
+        front::Parser parser(scanner, *arena, diagnostics);
+        auto program = std::make_optional(parser.parse_program());
+
+        const auto parsed = std::chrono::steady_clock::now();
+
+        if (scanner.has_failed() || parser.has_failed()) {
+            std::cerr << "The benchmark input couldn't be parsed." << std::endl;
+            return 1;
+        }
+
+        allocated = arena->allocated();
+
+        program.reset();
+        arena.reset();
+
+        const auto end = std::chrono::steady_clock::now();
+
+        parse_timings.push_back(std::chrono::duration<double, std::milli>(parsed - start).count());
+        teardown_timings.push_back(std::chrono::duration<double, std::milli>(end - parsed).count());
+    }
+
+    std::cout << "input:     " << data.size() << " bytes" << std::endl;
+    std::cout << "arena:     " << allocated << " bytes" << std::endl;
+    std::cout << "parse:     " << median(parse_timings) << " ms" << std::endl;
+    std::cout << "teardown:  " << median(teardown_timings) << " ms" << std::endl;
+
+    return 0;
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "front/scanner.hpp"
+#include "front/source.hpp"
+
+using namespace arkoi;
+
+static constexpr size_t DEFAULT_SIZE = 8 * 1024 * 1024;
+static constexpr size_t DEFAULT_ROUNDS = 10;
+
+static const std::string INPUT = TEST_PATH "/snapshot/scanner/08-all.ark";
+
+int main(int argc, char *argv[]) {
+    const auto target_size = (argc > 1 ? std::stoull(argv[1]) * 1024 * 1024 : DEFAULT_SIZE);
+    const auto rounds = (argc > 2 ? std::stoull(argv[2]) : DEFAULT_ROUNDS);
+
+    const auto source = front::Source::read(INPUT);
+
+    std::string data;
+    data.reserve(target_size + source.data().size());
+    while (data.size() < target_size) {
+        data += source.data();
+        if (!data.ends_with('\n')) data += '\n';
+    }
+
+    std::vector<double> timings;
+    size_t token_count = 0;
+
+    for (size_t round = 0; round < rounds; round++) {
+        const auto start = std::chrono::steady_clock::now();
+
+        DiagnosticEngine diagnostics;
+        front::Scanner scanner(data, diagnostics);
+        const auto tokens = scanner.tokenize();
+
+        const auto end = std::chrono::steady_clock::now();
+
+        if (scanner.has_failed()) {
+            std::cerr << "The benchmark input couldn't be scanned." << std::endl;
+            return 1;
+        }
+
+        token_count = tokens.size();
+        timings.push_back(std::chrono::duration<double>(end - start).count());
+    }
+
+    std::ranges::sort(timings);
+    const auto median = timings[timings.size() / 2];
+
+    std::cout << "input:     " << data.size() << " bytes" << std::endl;
+    std::cout << "tokens:    " << token_count << std::endl;
+    std::cout << "median:    " << median * 1e3 << " ms" << std::endl;
+    std::cout << "tokens/s:  " << static_cast<double>(token_count) / median << std::endl;
+    std::cout << "MB/s:      " << static_cast<double>(data.size()) / median / (1024 * 1024) << std::endl;
+
+    return 0;
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace arkoi::ast {
+
+class AstArena {
+private:
+    struct Destructor {
+        void (*destroy)(void *object, size_t count);
+        Destructor *previous;
+        void *object;
+        size_t count;
+    };
+
+public:
+    // The chunks start small and double up to the maximum size, as many arenas only hold a single function.
+    static constexpr size_t MIN_CHUNK_SIZE = 2 * 1024;
+    static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+public:
+    AstArena() = default;
+
+    AstArena(const AstArena &) = delete;
+
+    AstArena &operator=(const AstArena &) = delete;
+
+    ~AstArena();
+
+    template<typename Type, typename... Args>
+    [[nodiscard]] Type *make(Args &&... args);
+
+    template<typename Type>
+    [[nodiscard]] std::span<Type> make_span(std::vector<Type> &&elements);
+
+    /**
+     * Takes over every chunk and object of another arena, which is left empty. This allows nodes to be created in
+     * separate arenas on worker threads and to be owned by a single one afterwards.
+     *
+     * @param other The arena whose memory is moved into this one.
+     */
+    void absorb(AstArena &&other);
+
+    [[nodiscard]] auto allocated() const { return _allocated; }
+
+private:
+    [[nodiscard]] void *_allocate(size_t size, size_t alignment);
+
+    template<typename Type>
+    void _register(Type *object, size_t count);
+
+private:
+    std::vector<std::unique_ptr<std::byte[]>> _chunks{};
+    std::byte *_current{}, *_end{};
+    Destructor *_destructors{};
+    size_t _chunk_size{MIN_CHUNK_SIZE};
+    size_t _allocated{};
+};
+
+#include "../../src/ast/arena.tpp"
+
+} // namespace arkoi::ast
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
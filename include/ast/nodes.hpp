@@ -1,84 +1,121 @@
 #pragma once
 
+#include <cstdint>
+#include <span>
 #include <utility>
 
-#include "ast/visitor.hpp"
 #include "front/token.hpp"
-#include "sem/symbol_table.hpp"
+#include "sem/symbol.hpp"
 #include "sem/type.hpp"
 
 namespace arkoi::ast {
 
+// Nodes are allocated inside an ast::AstArena, which destroys them through their concrete type, thus the destructor
+// doesn't need to be virtual.
 class Node {
 public:
-    virtual ~Node() = default;
+    enum class Tag : uint8_t {
+        Program,
+        Block,
+        Identifier,
+        Parameter,
+        Function,
+        Return,
+        If,
+        Assign,
+        Variable,
+        Call,
+        Immediate,
+        Binary,
+        Cast,
+    };
+
+public:
+    /**
+     * Dispatches to the visit overload of the concrete node with a switch over its tag. As the type of the visitor
+     * is known statically, the traversal doesn't need a virtual call per node.
+     *
+     * @param visitor The visitor whose overload for this node is called.
+     */
+    template<typename Visitor>
+    decltype(auto) accept(Visitor &visitor);
+
+    [[nodiscard]] auto tag() const { return _tag; }
 
-    virtual void accept(Visitor &visitor) = 0;
+protected:
+    explicit Node(Tag tag) : _tag(tag) {}
+
+    ~Node() = default;
+
+private:
+    Tag _tag;
 };
 
+/**
+ * Casts the node to the given type by testing its tag, which replaces a dynamic_cast now that the nodes aren't
+ * polymorphic anymore.
+ *
+ * @param node The node to cast.
+ * @return The node as the given type, or nullptr if its tag doesn't match.
+ */
+template<typename Type>
+[[nodiscard]] Type *node_cast(Node *node);
+
 class Program final : public Node {
 public:
-    Program(std::vector<std::unique_ptr<Node>> &&statements, std::shared_ptr<sem::SymbolTable> table)
-        : _statements(std::move(statements)), _table(std::move(table)) {}
+    static constexpr Tag TAG = Tag::Program;
 
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    explicit Program(std::span<Node *> statements) : Node(TAG), _statements(statements) {}
 
     [[nodiscard]] auto &statements() const { return _statements; }
 
-    [[nodiscard]] auto &table() const { return _table; }
-
 private:
-    std::vector<std::unique_ptr<Node>> _statements;
-    std::shared_ptr<sem::SymbolTable> _table;
+    std::span<Node *> _statements;
 };
 
 class Block final : public Node {
 public:
-    Block(std::vector<std::unique_ptr<Node>> &&statements, std::shared_ptr<sem::SymbolTable> table)
-        : _statements(std::move(statements)), _table(std::move(table)) {}
+    static constexpr Tag TAG = Tag::Block;
 
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    explicit Block(std::span<Node *> statements) : Node(TAG), _statements(statements) {}
 
     [[nodiscard]] auto &statements() const { return _statements; }
 
-    [[nodiscard]] auto &table() const { return _table; }
-
 private:
-    std::vector<std::unique_ptr<Node>> _statements;
-    std::shared_ptr<sem::SymbolTable> _table;
+    std::span<Node *> _statements;
 };
 
 class Identifier final : public Node {
 public:
+    static constexpr Tag TAG = Tag::Identifier;
+
     enum class Kind {
         Function,
         Variable,
     };
 
 public:
-    Identifier(front::Token value, Kind kind) : _value(std::move(value)), _kind(kind) {}
-
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    Identifier(front::Token value, Kind kind) : Node(TAG), _value(std::move(value)), _kind(kind) {}
 
     [[nodiscard]] auto &symbol() const { return _symbol.value(); }
-    void set_symbol(std::shared_ptr<Symbol> symbol) { _symbol = std::move(symbol); }
+    void set_symbol(sem::SymbolId symbol) { _symbol = symbol; }
 
     [[nodiscard]] auto &value() const { return _value; }
 
     [[nodiscard]] auto &kind() const { return _kind; }
 
 private:
-    std::optional<std::shared_ptr<Symbol>> _symbol{};
+    std::optional<sem::SymbolId> _symbol{};
     front::Token _value;
     Kind _kind;
 };
 
 class Parameter final : public Node {
 public:
-    Parameter(Identifier name, sem::Type type)
-        : _name(std::move(name)), _type(std::move(type)) {}
+    static constexpr Tag TAG = Tag::Parameter;
 
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    Parameter(Identifier name, sem::Type type)
+        : Node(TAG), _name(std::move(name)), _type(std::move(type)) {}
 
     [[nodiscard]] auto &type() const { return _type; }
 
@@ -91,17 +128,20 @@ private:
 
 class Function final : public Node {
 public:
-    Function(Identifier name, std::vector<Parameter> &&parameters, sem::Type type,
-             std::unique_ptr<Block> &&block, std::shared_ptr<sem::SymbolTable> table)
-        : _table(std::move(table)), _parameters(std::move(parameters)), _block(std::move(block)),
-          _name(std::move(name)), _type(std::move(type)) {}
-
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    static constexpr Tag TAG = Tag::Function;
 
-    [[nodiscard]] auto &table() const { return _table; }
+    Function(Identifier name, std::span<Parameter> parameters, sem::Type type, Block *block, size_t locals)
+        : Node(TAG), _parameters(parameters), _block(block), _name(std::move(name)), _locals(locals),
+          _type(std::move(type)) {}
 
     [[nodiscard]] auto &type() const { return _type; }
 
+    /**
+     * The amount of variables declared in the block, which allows the symbols of a function to be reserved before
+     * its body is resolved.
+     */
+    [[nodiscard]] auto &locals() const { return _locals; }
+
     [[nodiscard]] auto &parameters() { return _parameters; }
 
     [[nodiscard]] auto &block() { return _block; }
@@ -109,104 +149,106 @@ public:
     [[nodiscard]] auto &name()  { return _name; }
 
 private:
-    std::shared_ptr<sem::SymbolTable> _table;
-    std::vector<Parameter> _parameters;
-    std::unique_ptr<Block> _block;
+    std::span<Parameter> _parameters;
+    Block *_block;
     Identifier _name;
+    size_t _locals;
     sem::Type _type;
 };
 
 class Return final : public Node {
 public:
-    explicit Return(std::unique_ptr<Node> &&expression) : _expression(std::move(expression)) {}
+    static constexpr Tag TAG = Tag::Return;
 
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    explicit Return(Node *expression) : Node(TAG), _expression(expression) {}
 
     [[nodiscard]] auto &type() const { return _type.value(); }
     void set_type(sem::Type type) { _type = std::move(type); }
 
     [[nodiscard]] auto &expression() { return _expression; }
-    void set_expression(std::unique_ptr<Node> &&node) { _expression = std::move(node); }
+    void set_expression(Node *node) { _expression = node; }
 
 private:
-    std::unique_ptr<Node> _expression;
+    Node *_expression;
     std::optional<sem::Type> _type{};
 };
 
 class If final : public Node {
 public:
-    If(std::unique_ptr<Node> &&condition, std::unique_ptr<Node> &&branch, std::unique_ptr<Node> &&next)
-        : _next(std::move(next)), _branch(std::move(branch)), _condition(std::move(condition)) {}
+    static constexpr Tag TAG = Tag::If;
 
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    If(Node *condition, Node *branch, Node *next)
+        : Node(TAG), _next(next), _branch(branch), _condition(condition) {}
 
     [[nodiscard]] auto &branch() const { return _branch; }
 
     [[nodiscard]] auto &next() const { return _next; }
 
     [[nodiscard]] auto &condition() { return _condition; }
-    void set_condition(std::unique_ptr<Node> &&condition) { _condition = std::move(condition); }
+    void set_condition(Node *condition) { _condition = condition; }
 
 private:
-    std::unique_ptr<Node> _next, _branch;
-    std::unique_ptr<Node> _condition;
+    Node *_next, *_branch;
+    Node *_condition;
 };
 
 class Assign final : public Node {
 public:
-    Assign(Identifier name, std::unique_ptr<Node> &&expression)
-        : _expression(std::move(expression)), _name(std::move(name)){}
+    static constexpr Tag TAG = Tag::Assign;
 
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    Assign(Identifier name, Node *expression)
+        : Node(TAG), _expression(expression), _name(std::move(name)){}
 
     [[nodiscard]] auto &expression() { return _expression; }
-    void set_expression(std::unique_ptr<Node> &&node) { _expression = std::move(node); }
+    void set_expression(Node *node) { _expression = node; }
 
     [[nodiscard]] auto &name() { return _name; }
 
 private:
-    std::unique_ptr<Node> _expression;
+    Node *_expression;
     Identifier _name;
 };
 
 class Variable final : public Node {
 public:
-    Variable(Identifier name, sem::Type type, std::unique_ptr<Node> &&expression)
-        : _expression(std::move(expression)), _name(std::move(name)), _type(std::move(type)) {}
+    static constexpr Tag TAG = Tag::Variable;
 
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    Variable(Identifier name, sem::Type type, Node *expression)
+        : Node(TAG), _expression(expression), _name(std::move(name)), _type(std::move(type)) {}
 
     [[nodiscard]] auto &expression() { return _expression; }
-    void set_expression(std::unique_ptr<Node> &&node) { _expression = std::move(node); }
+    void set_expression(Node *node) { _expression = node; }
 
     [[nodiscard]] auto &type() const { return _type; }
 
     [[nodiscard]] auto &name() { return _name; }
 
 private:
-    std::unique_ptr<Node> _expression;
+    Node *_expression;
     Identifier _name;
     sem::Type _type;
 };
 
 class Call final : public Node {
 public:
-    Call(Identifier name, std::vector<std::unique_ptr<Node>> &&arguments)
-        : _arguments(std::move(arguments)), _name(std::move(name)) {}
+    static constexpr Tag TAG = Tag::Call;
 
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    Call(Identifier name, std::span<Node *> arguments)
+        : Node(TAG), _arguments(arguments), _name(std::move(name)) {}
 
     [[nodiscard]] auto &arguments() { return _arguments; }
 
     [[nodiscard]] auto &name() { return _name; }
 
 private:
-    std::vector<std::unique_ptr<Node>> _arguments;
+    std::span<Node *> _arguments;
     Identifier _name;
 };
 
 class Immediate final : public Node {
 public:
+    static constexpr Tag TAG = Tag::Immediate;
+
     enum class Kind {
         Integer,
         Floating,
@@ -214,9 +256,7 @@ public:
     };
 
 public:
-    Immediate(front::Token value, Kind kind) : _value(std::move(value)), _kind(kind) {}
-
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    Immediate(front::Token value, Kind kind) : Node(TAG), _value(std::move(value)), _kind(kind) {}
 
     [[nodiscard]] auto &value() const { return _value; }
 
@@ -233,6 +273,8 @@ private:
 
 class Binary final : public Node {
 public:
+    static constexpr Tag TAG = Tag::Binary;
+
     enum class Operator {
         Add,
         Sub,
@@ -243,10 +285,8 @@ public:
     };
 
 public:
-    Binary(std::unique_ptr<Node> &&left, Operator op, std::unique_ptr<Node> &&right)
-        : _left(std::move(left)), _right(std::move(right)), _op(op) {}
-
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    Binary(Node *left, Operator op, Node *right)
+        : Node(TAG), _left(left), _right(right), _op(op) {}
 
     [[nodiscard]] auto &op() const { return _op; }
 
@@ -254,29 +294,29 @@ public:
     void set_op_type(sem::Type type) { _op_type = std::move(type); }
 
     [[nodiscard]] auto &right() { return _right; }
-    void set_right(std::unique_ptr<Node> &&node) { _right = std::move(node); }
+    void set_right(Node *node) { _right = node; }
 
     [[nodiscard]] auto &left() { return _left; }
-    void set_left(std::unique_ptr<Node> &&node) { _left = std::move(node); }
+    void set_left(Node *node) { _left = node; }
 
     [[nodiscard]] auto &result_type() const { return _result_type.value(); }
     void set_result_type(sem::Type type) { _result_type = std::move(type); }
 
 private:
     std::optional<sem::Type> _result_type{}, _op_type{};
-    std::unique_ptr<Node> _left, _right;
+    Node *_left, *_right;
     Operator _op;
 };
 
 class Cast final : public Node {
 public:
-    Cast(std::unique_ptr<Node> &&expression, sem::Type from, sem::Type to)
-        : _expression(std::move(expression)), _from(from), _to(std::move(to)) {}
+    static constexpr Tag TAG = Tag::Cast;
 
-    Cast(std::unique_ptr<Node> &&expression, sem::Type to)
-        : _expression(std::move(expression)), _to(std::move(to)) {}
+    Cast(Node *expression, sem::Type from, sem::Type to)
+        : Node(TAG), _expression(expression), _from(from), _to(std::move(to)) {}
 
-    void accept(Visitor &visitor) override { visitor.visit(*this); }
+    Cast(Node *expression, sem::Type to)
+        : Node(TAG), _expression(expression), _to(std::move(to)) {}
 
     [[nodiscard]] auto &expression() const { return _expression; }
 
@@ -286,11 +326,13 @@ public:
     [[nodiscard]] auto &to() const { return _to; }
 
 private:
-    std::unique_ptr<Node> _expression;
+    Node *_expression;
     std::optional<sem::Type> _from{};
     sem::Type _to;
 };
 
+#include "../../src/ast/nodes.tpp"
+
 }  // namespace arkoi::ast
 
 //==============================================================================
@@ -12,10 +12,15 @@ class Assign;
 class Return;
 class Binary;
 class Block;
+class Node;
 class Cast;
 class Call;
 class If;
 
+/**
+ * The interface every pass over the AST implements. Node::accept calls the overloads on the concrete pass, thus they
+ * aren't dispatched virtually as long as the pass is final.
+ */
 class Visitor {
 public:
     virtual ~Visitor() = default;
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ast/arena.hpp"
+#include "ast/nodes.hpp"
+#include "front/token.hpp"
+#include "utils/diagnostics.hpp"
+
+namespace arkoi::front {
+
+/**
+ * Replaces "length" bytes starting at "offset" with the replacement text.
+ */
+struct TextEdit {
+    size_t offset;
+    size_t length;
+    std::string replacement;
+};
+
+/**
+ * An in-memory source, which is kept scanned and parsed while it is being edited.
+ *
+ * The text is split at top-level functions, as every "fun" at column 0 starts with the indentation reset. Each of
+ * those chunks owns its text, tokens and nodes, thus an edit only re-scans and re-parses the functions it touches,
+ * while every other ast::Function is reused. As a chunk is always scanned on its own, an edit
+ * can't shift the indentation tokens of another function. The tokens stored in a chunk are relative to its start,
+ * thus an edit doesn't move the tokens of the following chunks. Only tokens() and diagnostics() map them to offsets
+ * into the whole text.
+ *
+ * The nodes are only parsed, the semantic passes annotate them in place. Their tokens stay relative to their chunk,
+ * and the symbols aren't kept per chunk, thus the program has to be resolved as a whole after every edit.
+ */
+class Document {
+public:
+    explicit Document(std::string_view text);
+
+    Document(const Document &) = delete;
+
+    Document &operator=(const Document &) = delete;
+
+    /**
+     * Applies the edit and re-parses the affected functions. If the edit merges a function into its neighbour, e.g.
+     * by removing the "fun" keyword, the neighbour is re-parsed as well.
+     *
+     * @param edit The range to replace, which must lie within the text.
+     * @return The amount of chunks which were re-parsed.
+     */
+    size_t apply(const TextEdit &edit);
+
+    /**
+     * Puts the statements of all chunks together. The program stays valid until the next edit is applied.
+     */
+    [[nodiscard]] ast::Program program();
+
+    /**
+     * Returns the tokens of all chunks in source order with their offsets into the whole text, terminated by a single
+     * End Of File token at the end of the text.
+     */
+    [[nodiscard]] std::vector<Token> tokens() const;
+
+    [[nodiscard]] std::string text() const;
+
+    [[nodiscard]] bool has_failed() const;
+
+    /**
+     * Returns the diagnostics of all chunks in source order with their offsets into the whole text.
+     */
+    [[nodiscard]] std::vector<Diagnostic> diagnostics() const;
+
+private:
+    struct Chunk {
+        std::string text;
+        std::vector<Token> tokens;
+        ast::AstArena arena;
+        std::vector<ast::Node *> statements;
+        DiagnosticEngine diagnostics;
+        bool failed{};
+    };
+
+    [[nodiscard]] std::unique_ptr<Chunk> _parse(std::string_view text) const;
+
+private:
+    std::vector<std::unique_ptr<Chunk>> _chunks{};
+    std::vector<ast::Node *> _statements{};
+};
+
+} // namespace arkoi::front
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -1,113 +1,180 @@
 #pragma once
 
-#include <functional>
-#include <stack>
+#include <memory>
 #include <vector>
 
+#include "ast/arena.hpp"
 #include "ast/nodes.hpp"
+#include "front/scanner.hpp"
 #include "front/token.hpp"
+#include "front/token_stream.hpp"
+#include "utils/diagnostics.hpp"
+#include "utils/thread_pool.hpp"
 #include "utils/utils.hpp"
 
 namespace arkoi::front {
 
 class Parser {
 public:
-    explicit Parser(std::vector<Token> &&tokens) : _tokens(std::move(tokens)) {}
+    Parser(std::vector<Token> &&tokens, ast::AstArena &arena, DiagnosticEngine &diagnostics)
+        : _tokens(std::move(tokens)), _diagnostics(diagnostics), _arena(arena) {}
+
+    Parser(Scanner &scanner, ast::AstArena &arena, DiagnosticEngine &diagnostics)
+        : _tokens(scanner), _diagnostics(diagnostics), _arena(arena) {}
 
     [[nodiscard]] ast::Program parse_program();
 
+    /**
+     * Parses the whole source in parallel, by splitting it at top-level functions and scanning and parsing every
+     * chunk on the thread pool. The chunks and their diagnostics are merged in source order, thus the result equals
+     * the serial one.
+     *
+     * @param data The whole source buffer, which must outlive the program.
+     * @param arena The arena which owns all nodes afterwards.
+     * @param diagnostics The engine which receives the diagnostics of all chunks.
+     * @param pool The thread pool the chunks are parsed on.
+     * @return The program, or std::nullopt if scanning or parsing any chunk failed.
+     */
+    [[nodiscard]] static std::optional<ast::Program> parse_program(std::string_view data, ast::AstArena &arena,
+                                                                   DiagnosticEngine &diagnostics, ThreadPool &pool);
+
+    /**
+     * A part of the program, whose nodes are owned by an arena of its own. Thus the nodes of a part may be destroyed
+     * as soon as it was compiled, while the other parts are still alive.
+     */
+    struct Part {
+        ast::Program program;
+        std::unique_ptr<ast::AstArena> arena;
+    };
+
+    /**
+     * Parses the whole source into a part per top-level function, which results in the same statements and
+     * diagnostics as the serial parser. Only if the recovery from an error swallows the next function, both functions
+     * end up in the same part.
+     *
+     * @param data The whole source buffer, which must outlive the parts.
+     * @param diagnostics The engine which receives the diagnostics of all parts.
+     * @return The parts in source order, or std::nullopt if scanning or parsing any part failed.
+     */
+    [[nodiscard]] static std::optional<std::vector<Part>> parse_parts(std::string_view data,
+                                                                      DiagnosticEngine &diagnostics);
+
+    /**
+     * Does the same as parse_parts(std::string_view, DiagnosticEngine &), but scans and parses the parts on the
+     * thread pool.
+     *
+     * @param data The whole source buffer, which must outlive the parts.
+     * @param diagnostics The engine which receives the diagnostics of all parts.
+     * @param pool The thread pool the parts are parsed on.
+     * @return The parts in source order, or std::nullopt if scanning or parsing any part failed.
+     */
+    [[nodiscard]] static std::optional<std::vector<Part>> parse_parts(std::string_view data,
+                                                                      DiagnosticEngine &diagnostics, ThreadPool &pool);
+
     [[nodiscard]] auto has_failed() const { return _failed; }
 
+    /**
+     * Parses the top-level statements of a part of a program. Those parts may be put together into a single program
+     * afterwards, as the scopes are only built by the name resolver.
+     *
+     * @param boundary The offset of the "fun" which starts the next part, the statements end in front of it.
+     */
+    [[nodiscard]] std::vector<ast::Node *> parse_program_statements(std::optional<uint32_t> boundary = std::nullopt);
+
+    /**
+     * Checks if the last parse_program_statements call went past its boundary, as an error swallowed the "fun" of
+     * the next part.
+     */
+    [[nodiscard]] auto crossed_boundary() const { return _crossed_boundary; }
+
+private:
+    /**
+     * Splits the source into chunks of at least "chunk_size" bytes, which are parsed on the thread pool or, without
+     * one, right after each other.
+     */
+    [[nodiscard]] static std::optional<std::vector<Part>> _parse_parts(std::string_view data, size_t chunk_size,
+                                                                       DiagnosticEngine &diagnostics,
+                                                                       ThreadPool *pool);
+
+    /**
+     * The error a parse function stopped at. It is passed up until a recovery point handles it, just like an
+     * exception would unwind, while every parse function returns right away as long as it is set.
+     */
+    enum class Error {
+        None,
+        UnexpectedToken,
+        EndOfTokens,
+        Aborted,
+    };
+
 private:
-    [[nodiscard]] std::unique_ptr<ast::Node> _parse_program_statement();
+    [[nodiscard]] ast::Node *_parse_program_statement();
 
     void _recover_program();
 
-    [[nodiscard]] std::unique_ptr<ast::Function> _parse_function(const Token &keyword);
+    [[nodiscard]] ast::Function *_parse_function(const Token &keyword);
 
     [[nodiscard]] std::vector<ast::Parameter> _parse_parameters();
 
     void _recover_parameters();
 
-    [[nodiscard]] ast::Parameter _parse_parameter();
+    [[nodiscard]] std::optional<ast::Parameter> _parse_parameter();
 
-    [[nodiscard]] sem::Type _parse_type();
+    [[nodiscard]] std::optional<sem::Type> _parse_type();
 
-    [[nodiscard]] std::unique_ptr<ast::Block> _parse_block();
+    [[nodiscard]] ast::Block *_parse_block();
 
-    [[nodiscard]] std::unique_ptr<ast::Node> _parse_block_statement();
+    [[nodiscard]] ast::Node *_parse_block_statement();
 
     void _recover_block();
 
-    [[nodiscard]] std::unique_ptr<ast::Return> _parse_return(const Token &keyword);
-
-    [[nodiscard]] std::unique_ptr<ast::If> _parse_if(const Token &keyword);
-
-    [[nodiscard]] std::unique_ptr<ast::Assign> _parse_assign(const Token &name);
-
-    [[nodiscard]] std::unique_ptr<ast::Variable> _parse_variable(const Token &name);
-
-    [[nodiscard]] std::unique_ptr<ast::Call> _parse_call(const Token &name);
-
-    [[nodiscard]] std::unique_ptr<ast::Node> _parse_expression();
+    [[nodiscard]] ast::Return *_parse_return(const Token &keyword);
 
-    [[nodiscard]] std::unique_ptr<ast::Node> _parse_comparison();
+    [[nodiscard]] ast::If *_parse_if(const Token &keyword);
 
-    [[nodiscard]] std::unique_ptr<ast::Node> _parse_term();
+    [[nodiscard]] ast::Assign *_parse_assign(const Token &name);
 
-    [[nodiscard]] std::unique_ptr<ast::Node> _parse_factor();
+    [[nodiscard]] ast::Variable *_parse_variable(const Token &name);
 
-    [[nodiscard]] std::unique_ptr<ast::Node> _parse_primary();
+    [[nodiscard]] ast::Call *_parse_call(const Token &name);
 
-    [[nodiscard]] std::shared_ptr<sem::SymbolTable> _current_scope();
+    /**
+     * Parses an expression by precedence climbing, where the binary operators and their binding power are looked up
+     * in a static table. Only operators which bind tighter than the given power are consumed.
+     */
+    [[nodiscard]] ast::Node *_parse_expression(uint8_t min_power = 0);
 
-    std::shared_ptr<sem::SymbolTable> _enter_scope();
-
-    void _exit_scope();
+    [[nodiscard]] ast::Node *_parse_primary();
 
     [[nodiscard]] const Token &_current();
 
     void _next();
 
-    const Token &_consume_any();
-
-    const Token &_consume(Token::Type type);
+    Token _consume_any();
 
-    [[nodiscard]] std::optional<Token> _try_consume(const std::function<bool(const Token &)> &predicate);
+    Token _consume(Token::Type type);
 
     std::optional<Token> _try_consume(Token::Type type);
 
-    [[nodiscard]] static ast::Binary::Operator _to_binary_operator(const Token &token);
+    [[nodiscard]] bool _is_failing() const { return _error != Error::None; }
 
-    [[nodiscard]] static bool _is_factor_operator(const Token &token);
+    void _unexpected(const std::string &expected, const Token &got);
 
-    [[nodiscard]] static bool _is_comparison_operator(const Token &token);
+    void _end_of_tokens();
 
-    [[nodiscard]] static bool _is_term_operator(const Token &token);
+    void _report(Diagnostic diagnostic);
 
 private:
-    std::stack<std::shared_ptr<sem::SymbolTable>> _scopes{};
-    std::vector<Token> _tokens;
-    size_t _position{};
+    TokenStream _tokens;
+    DiagnosticEngine &_diagnostics;
+    ast::AstArena &_arena;
+    Error _error{Error::None};
+    size_t _locals{};
+    bool _crossed_boundary{};
+    bool _reached_end{};
     bool _failed{};
 };
 
-class ParserError : public std::runtime_error {
-public:
-    explicit ParserError(const std::string &error) : std::runtime_error(error) {}
-};
-
-class UnexpectedEndOfTokens final : public ParserError {
-public:
-    UnexpectedEndOfTokens() : ParserError("Unexpectedly reached the End Of Tokens") {}
-};
-
-class UnexpectedToken final : public ParserError {
-public:
-    UnexpectedToken(const std::string &expected, const Token &got)
-        : ParserError("Expected " + expected + " but got " + to_string(got.type())) {}
-};
-
 } // namespace arkoi::front
 
 //==============================================================================
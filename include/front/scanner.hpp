@@ -1,116 +1,138 @@
 #pragma once
 
-#include <functional>
+#include <cstdint>
+#include <optional>
 #include <string>
-#include <utility>
+#include <string_view>
 #include <vector>
 
 #include "token.hpp"
+#include "utils/diagnostics.hpp"
 
 namespace arkoi::front {
 
 class Scanner {
 private:
-    struct Location {
-        size_t column, row;
+    enum class State {
+        LineStart,
+        Indentation,
+        Line,
+        LineEnd,
+        EndOfFile,
     };
 
 public:
-    explicit Scanner(std::string data) : _data(std::move(data)) {}
+    /**
+     * A part of the source, which starts at a top-level function and is scanned on its own.
+     */
+    struct Chunk {
+        std::string_view data;
+        uint32_t offset;
+    };
+
+    enum CharClass : uint8_t {
+        Space = 1 << 0,
+        Digit = 1 << 1,
+        IdentStart = 1 << 2,
+        Hex = 1 << 3,
+        HexExpo = 1 << 4,
+        Expo = 1 << 5,
+        DecimalSign = 1 << 6,
+        Ascii = 1 << 7,
+    };
+
+public:
+    /**
+     * @param data The source to scan, which must outlive the tokens.
+     * @param diagnostics The engine which receives every error.
+     * @param offset The offset of the data within the whole source, which is added to the offset of every token.
+     * @param followed If another chunk follows the data, in which case the "fun" starting it is returned in front of
+     *                 the end of file, just like scanning the whole source would.
+     */
+    Scanner(std::string_view data, DiagnosticEngine &diagnostics, uint32_t offset = 0, bool followed = false)
+        : _offset(offset), _data(data), _diagnostics(diagnostics), _followed(followed) {}
+
+    /**
+     * Splits the source at top-level "fun" lines, as those always start at column 0 with the indentation reset.
+     *
+     * The line walk mirrors the one of the scanner, thus scanning every chunk with its offset results in the same
+     * tokens as scanning the whole source at once.
+     *
+     * @param data The whole source buffer.
+     * @param chunk_size The amount of bytes after which a chunk is cut at the next top-level function.
+     * @return The chunks in source order, which together cover the whole buffer.
+     */
+    [[nodiscard]] static std::vector<Chunk> split(std::string_view data, size_t chunk_size);
+
+    /**
+     * Checks if the given line starts with the "fun" keyword at column 0, thus begins a top-level function.
+     */
+    [[nodiscard]] static bool is_function_start(std::string_view line);
 
     [[nodiscard]] std::vector<Token> tokenize();
 
+    [[nodiscard]] Token next_token();
+
     [[nodiscard]] auto has_failed() const { return _failed; }
 
 private:
-    [[nodiscard]] Token _next_token();
+    [[nodiscard]] std::optional<Token> _lex_token();
 
-    [[nodiscard]] Token _lex_comment();
+    [[nodiscard]] std::optional<Token> _lex_comment();
 
-    [[nodiscard]] Token _lex_identifier();
+    [[nodiscard]] std::optional<Token> _lex_identifier();
 
-    [[nodiscard]] Token _lex_number();
+    [[nodiscard]] std::optional<Token> _lex_number();
 
-    [[nodiscard]] Token _lex_char();
+    [[nodiscard]] std::optional<Token> _lex_char();
 
-    [[nodiscard]] Token _lex_special();
+    [[nodiscard]] std::optional<Token> _lex_special();
 
-    [[nodiscard]] std::string _current_view() const;
+    [[nodiscard]] std::string_view _current_view() const;
 
     [[nodiscard]] char _current_char() const;
 
     [[nodiscard]] bool _is_eol() const;
 
-    [[nodiscard]] Location _mark_start();
+    [[nodiscard]] uint32_t _mark_start();
+
+    [[nodiscard]] uint32_t _position(size_t column) const;
 
     void _next();
 
     char _peek() const;
 
-    void _consume(char expected);
+    [[nodiscard]] bool _consume(char expected);
 
-    char _consume(const std::function<bool(char)> &predicate, const std::string &expected);
+    [[nodiscard]] std::optional<char> _consume(CharClass expected_class, std::string_view expected);
 
-    [[nodiscard]] bool _try_consume(char expected);
+    void _report(Diagnostic::Code code, Span span, std::vector<std::string> args = {});
 
-    [[nodiscard]] std::optional<char> _try_consume(const std::function<bool(char)> &predicate);
-
-    [[nodiscard]] static size_t _leading_spaces(const std::string &line);
-
-    [[nodiscard]] static bool _is_digit(char input);
-
-    [[nodiscard]] static bool _is_ident_start(char input);
-
-    [[nodiscard]] static bool _is_ident_inner(char input);
-
-    [[nodiscard]] static bool _is_not_newline(char input);
+    [[nodiscard]] bool _try_consume(char expected);
 
-    [[nodiscard]] static bool _is_ascii(char input);
+    [[nodiscard]] std::optional<char> _try_consume(CharClass expected_class);
 
-    [[nodiscard]] static bool _is_space(char input);
+    [[nodiscard]] size_t _leading_spaces() const;
 
-    [[nodiscard]] static bool _is_hex(char input);
+    void _skip_line(size_t offset);
 
-    [[nodiscard]] static bool _is_hex_expo(char input);
+    [[nodiscard]] const char *_cursor() const;
 
-    [[nodiscard]] static bool _is_expo(char input);
+    [[nodiscard]] const char *_end() const;
 
-    [[nodiscard]] static bool _is_decimal_sign(char input);
+    [[nodiscard]] static bool _is(char input, CharClass expected_class);
 
 private:
-    size_t _start{}, _row{}, _column{}, _indentation{};
-    std::string_view _current_line;
-    std::string _data;
+    size_t _line{}, _leading{}, _start{}, _column{}, _indentation{};
+    uint32_t _offset;
+    State _state{State::LineStart};
+    Diagnostic::Code _error{};
+    std::string_view _data;
+    DiagnosticEngine &_diagnostics;
+    bool _followed;
     bool _failed{};
 };
 
-class ScannerError : public std::runtime_error {
-public:
-    explicit ScannerError(const std::string &error) : std::runtime_error(error) {}
-};
-
-class UnexpectedEndOfLine final : public ScannerError {
-public:
-    UnexpectedEndOfLine() : ScannerError("Unexpectedly reached the End Of Line") {}
-};
-
-class UnexpectedChar final : public ScannerError {
-public:
-    UnexpectedChar(const std::string &expected, char got)
-        : ScannerError("Expected " + expected + " but got " + std::string(1, got)) {}
-};
-
-class UnknownChar final : public ScannerError {
-public:
-    explicit UnknownChar(char got) : ScannerError("Didn't expect " + std::string(1, got)) {}
-};
-
-class NumberOutOfRange final : public ScannerError {
-public:
-    explicit NumberOutOfRange(const std::string &number)
-        : ScannerError("The number " + number + " exceeds the 64bit limitations.") {}
-};
-
 } // namespace arkoi::front
 
 //==============================================================================
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace arkoi::front {
+
+class Source {
+public:
+    Source(const Source &) = delete;
+
+    Source &operator=(const Source &) = delete;
+
+    Source(Source &&other) noexcept;
+
+    Source &operator=(Source &&other) noexcept;
+
+    ~Source();
+
+    [[nodiscard]] static Source read(const std::filesystem::path &path);
+
+    // Maps the file read-only into memory, so the scanner can walk it without ever copying the contents.
+    [[nodiscard]] static Source map(const std::filesystem::path &path);
+
+    [[nodiscard]] std::string_view data() const;
+
+private:
+    Source() = default;
+
+    void _unmap();
+
+private:
+    std::string _buffer;
+    const char *_mapping{};
+    size_t _mapping_size{};
+};
+
+class SourceError final : public std::runtime_error {
+public:
+    SourceError(const std::filesystem::path &path, const std::string &reason)
+        : std::runtime_error("Couldn't load " + path.string() + ": " + reason) {}
+};
+
+} // namespace arkoi::front
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
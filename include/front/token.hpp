@@ -1,8 +1,13 @@
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <optional>
+#include <string_view>
 #include <utility>
+#include <variant>
+
+#include "utils/string_interner.hpp"
 
 namespace arkoi::front {
 
@@ -56,26 +61,53 @@ public:
         Unknown,
     };
 
+    // The value of integer and floating literals, which are decoded once while scanning.
+    using Number = std::variant<std::monostate, int64_t, double>;
+
 public:
-    Token(Type type, size_t column, size_t row, std::string contents)
-        : _contents(std::move(contents)), _column(column), _row(row), _type(type) {}
+    Token(Type type, uint32_t offset, std::string_view contents)
+        : _contents(contents), _offset(offset), _type(type) {}
+
+    Token(Type type, uint32_t offset, std::string_view contents, Name name)
+        : _contents(contents), _offset(offset), _type(type), _name(name) {}
+
+    Token(Type type, uint32_t offset, std::string_view contents, Number number)
+        : _contents(contents), _number(number), _offset(offset), _type(type) {}
+
+    /**
+     * Copies the token with its offset moved forward, e.g. from a part of the source to the whole source.
+     *
+     * @param distance The amount of bytes the offset is moved by.
+     */
+    [[nodiscard]] Token shifted(uint32_t distance) const {
+        auto token = *this;
+        token._offset += distance;
+        return token;
+    }
 
     [[nodiscard]] auto &contents() const { return _contents; }
 
-    [[nodiscard]] auto column() const { return _column; }
+    [[nodiscard]] auto offset() const { return _offset; }
 
     [[nodiscard]] auto &type() const { return _type; }
 
-    [[nodiscard]] auto row() const { return _row; }
+    [[nodiscard]] auto name() const { return _name; }
+
+    [[nodiscard]] auto &number() const { return _number; }
 
     [[nodiscard]] static std::optional<Type> lookup_keyword(const std::string_view &value);
 
     [[nodiscard]] static std::optional<Type> lookup_special(char value);
 
 private:
-    std::string _contents;
-    size_t _column, _row;
+    // A view into the source buffer, which must outlive every token scanned from it.
+    std::string_view _contents;
+    Number _number{};
+    // The byte offset into the source, its row and column are only resolved through a LineTable when needed.
+    uint32_t _offset;
     Type _type;
+    // Only identifiers are interned, every other token keeps the empty name.
+    Name _name{};
 };
 
 } // namespace arkoi::front
@@ -1,33 +1,133 @@
 #pragma once
 
+#include <optional>
+#include <ranges>
+#include <unordered_map>
+
 #include "il/dataflow.hpp"
+#include "utils/bit_set.hpp"
 
 namespace arkoi::il {
 
+/**
+ * Numbers the non-immediate operands of a function densely, thus dataflow states can be bit sets. The variables keep
+ * their virtual register as index, the memory operands are numbered after them.
+ */
+class OperandIndex {
+public:
+    explicit OperandIndex(Function &function);
+
+    [[nodiscard]] std::optional<size_t> find(const Operand &operand) const;
+
+    [[nodiscard]] auto &operator[](size_t index) const { return _operands[index]; }
+
+    [[nodiscard]] auto size() const { return _operands.size(); }
+
+private:
+    void _insert(const Operand &operand);
+
+private:
+    std::vector<Operand> _operands{};
+    std::vector<size_t> _memories{};
+    size_t _memory_base{};
+};
+
+template<typename Set = BitSet>
 class BlockLivenessAnalysis final :
-        public DataflowPass<Operand, DataflowDirection::Backward, DataflowGranularity::Block> {
+        public DataflowPass<UnionLattice<Set>, DataflowDirection::Backward, DataflowGranularity::Block> {
+public:
+    using Lattice = UnionLattice<Set>;
+    using State = Set;
+
 public:
-    BlockLivenessAnalysis() = default;
+    explicit BlockLivenessAnalysis(const OperandIndex &operands)
+        : _operands(operands), _lattice(operands.size()) {}
 
-    State merge(const std::vector<State> &predecessors) override;
+    [[nodiscard]] const Lattice &lattice() const override { return _lattice; }
 
     State initialize(Function &function, BasicBlock &current) override;
 
     State transfer(BasicBlock &current, const State &state) override;
+
+    [[nodiscard]] auto &operands() const { return _operands; }
+
+private:
+    // The operands used before being defined in a block and all operands defined in it.
+    std::unordered_map<BasicBlock *, State> _uses{};
+    std::unordered_map<BasicBlock *, State> _definitions{};
+    const OperandIndex &_operands;
+    Lattice _lattice;
 };
 
+template<typename Set = BitSet>
 class InstructionLivenessAnalysis final :
-        public DataflowPass<Operand, DataflowDirection::Backward, DataflowGranularity::Instruction> {
+        public DataflowPass<UnionLattice<Set>, DataflowDirection::Backward, DataflowGranularity::Instruction> {
+public:
+    using Lattice = UnionLattice<Set>;
+    using State = Set;
+
 public:
-    InstructionLivenessAnalysis() = default;
+    explicit InstructionLivenessAnalysis(const OperandIndex &operands)
+        : _operands(operands), _lattice(operands.size()) {}
 
-    State merge(const std::vector<State> &predecessors) override;
+    [[nodiscard]] const Lattice &lattice() const override { return _lattice; }
 
     State initialize(Function &function, Instruction &instruction) override;
 
     State transfer(Instruction &current, const State &state) override;
+
+    /**
+     * Turns the operands live after the instruction into the ones live before it.
+     */
+    static void apply(Instruction &instruction, State &live, const OperandIndex &operands);
+
+    [[nodiscard]] auto &operands() const { return _operands; }
+
+private:
+    const OperandIndex &_operands;
+    Lattice _lattice;
 };
 
+/**
+ * Replays a block backwards from its live-out set and hands out every instruction together with the operands live
+ * after it. Thus only the block boundaries have to be stored, instead of two sets for each instruction. The replay
+ * can only be iterated once.
+ */
+template<typename Set = BitSet>
+class LivenessReplay {
+public:
+    class Iterator {
+    public:
+        Iterator(LivenessReplay &replay, BasicBlock::Instructions::reverse_iterator current)
+            : _current(current), _replay(&replay) {}
+
+        std::pair<Instruction &, const Set &> operator*() const { return {*_current, _replay->_live}; }
+
+        Iterator &operator++();
+
+        bool operator==(const Iterator &other) const { return _current == other._current; }
+
+    private:
+        BasicBlock::Instructions::reverse_iterator _current;
+        LivenessReplay *_replay;
+    };
+
+public:
+    LivenessReplay(BasicBlock &block, Set live_out, const OperandIndex &operands)
+        : _live(std::move(live_out)), _operands(operands), _block(block) {}
+
+    Iterator begin() { return Iterator(*this, _block.instructions().rbegin()); }
+
+    Iterator end() { return Iterator(*this, _block.instructions().rend()); }
+
+private:
+    Set _live;
+    const OperandIndex &_operands;
+    BasicBlock &_block;
+};
+
+#include "../../src/il/analyses.tpp"
+
 } // namespace arkoi::il
 
 //==============================================================================
@@ -19,14 +19,14 @@ public:
     using Instructions = std::vector<Instruction>;
 
 public:
-    explicit BasicBlock(std::string label) : _branch(), _next(), _label(std::move(label)) {}
+    explicit BasicBlock(Name label) : _branch(), _next(), _label(label) {}
 
     void accept(Visitor &visitor) { visitor.visit(*this); }
 
     template<typename Type, typename... Args>
     Instruction &emplace_back(Args &&... args);
 
-    [[nodiscard]] auto &label() const { return _label; }
+    [[nodiscard]] auto label() const { return _label; }
 
     [[nodiscard]] auto *branch() const { return _branch; }
     void set_branch(BasicBlock *branch);
@@ -47,7 +47,7 @@ private:
     Predecessors _predecessors;
     BasicBlock *_branch;
     BasicBlock *_next;
-    std::string _label;
+    Name _label;
 };
 
 class BlockIterator {
@@ -85,10 +85,9 @@ private:
 
 class Function {
 public:
-    Function(const std::string& name, std::vector<Variable> parameters, sem::Type type);
+    Function(Name name, std::vector<Variable> parameters, sem::Type type);
 
-    Function(std::string name, std::vector<Variable> parameters, sem::Type type,
-             std::string entry_label, std::string exit_label);
+    Function(Name name, std::vector<Variable> parameters, sem::Type type, Name entry_label, Name exit_label);
 
     void accept(Visitor &visitor) { visitor.visit(*this); }
 
@@ -97,9 +96,15 @@ public:
 
     [[nodiscard]] bool is_leaf();
 
+    /**
+     * Lists the blocks reachable from the entry, each one after all of its successors except for back edges. The exit
+     * is always part of it, even if it can't be reached.
+     */
+    [[nodiscard]] std::vector<BasicBlock *> postorder() const;
+
     [[nodiscard]] bool remove(BasicBlock *block);
 
-    [[nodiscard]] auto &name() const { return _name; }
+    [[nodiscard]] auto name() const { return _name; }
 
     [[nodiscard]] auto &type() const { return _type; }
 
@@ -110,6 +115,13 @@ public:
 
     [[nodiscard]] auto &parameters() { return _parameters; }
 
+    /**
+     * The parameters occupy the first virtual registers, thus new ones are numbered after them.
+     */
+    [[nodiscard]] VRegId make_vreg() { return VRegId(_vreg_count++); }
+
+    [[nodiscard]] auto vreg_count() const { return _vreg_count; }
+
     BlockIterator begin() { return BlockIterator(this); }
 
     BlockIterator end() { return BlockIterator(nullptr); }
@@ -119,7 +131,8 @@ private:
     BasicBlock *_entry;
     BasicBlock *_exit;
     std::vector<Variable> _parameters;
-    std::string _name;
+    uint32_t _vreg_count;
+    Name _name;
     sem::Type _type;
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <optional>
+
 #include "il/analyses.hpp"
 #include "il/cfg.hpp"
 #include "il/dataflow.hpp"
@@ -45,7 +47,8 @@ public:
     [[nodiscard]] auto &output() const { return _output; }
 
 private:
-    DataflowAnalysis<BlockLivenessAnalysis> _liveness{};
+    std::optional<DataflowAnalysis<BlockLivenessAnalysis<>>> _liveness{};
+    std::optional<OperandIndex> _operands{};
     Function *_current_function;
     std::stringstream &_output;
     ILPrinter _printer;
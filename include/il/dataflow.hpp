@@ -1,6 +1,11 @@
 #pragma once
 
+#include <algorithm>
 #include <concepts>
+#include <queue>
+#include <ranges>
+#include <unordered_map>
+#include <vector>
 
 #include "il/cfg.hpp"
 #include "il/instruction.hpp"
@@ -17,12 +22,67 @@ enum class DataflowGranularity {
     Instruction
 };
 
-template<typename ResultType, DataflowDirection DirectionType, DataflowGranularity GranularityType>
+/**
+ * The states of a dataflow problem form a semi-lattice. Meeting the states of the neighbours of a target yields its
+ * incoming state, where the top element is the identity of the meet and the bottom element absorbs everything.
+ */
+template<typename Type>
+concept Lattice = requires(const Type &lattice, typename Type::Value &value, const typename Type::Value &other) {
+    { lattice.top() } -> std::same_as<typename Type::Value>;
+    { lattice.bottom() } -> std::same_as<typename Type::Value>;
+    lattice.meet(value, other);
+} && std::equality_comparable<typename Type::Value>;
+
+/**
+ * Sets of indices below a fixed size, met by their union. Used by may problems like liveness, where a fact holds if
+ * it holds along any path.
+ */
+template<typename Set>
+class UnionLattice {
+public:
+    using Value = Set;
+
+public:
+    explicit UnionLattice(size_t size) : _size(size) {}
+
+    [[nodiscard]] Value top() const { return Value(_size); }
+
+    [[nodiscard]] Value bottom() const;
+
+    void meet(Value &value, const Value &other) const { value |= other; }
+
+private:
+    size_t _size;
+};
+
+/**
+ * Sets of indices below a fixed size, met by their intersection. Used by must problems like available expressions,
+ * where a fact only holds if it holds along every path.
+ */
+template<typename Set>
+class IntersectionLattice {
+public:
+    using Value = Set;
+
+public:
+    explicit IntersectionLattice(size_t size) : _size(size) {}
+
+    [[nodiscard]] Value top() const;
+
+    [[nodiscard]] Value bottom() const { return Value(_size); }
+
+    void meet(Value &value, const Value &other) const { value &= other; }
+
+private:
+    size_t _size;
+};
+
+template<Lattice LatticeType, DataflowDirection DirectionType, DataflowGranularity GranularityType>
 class DataflowPass {
 public:
     using Target = std::conditional_t<GranularityType == DataflowGranularity::Block, BasicBlock, Instruction>;
-    using Result [[maybe_unused]] = ResultType;
-    using State = std::unordered_set<Result>;
+    using Lattice = LatticeType;
+    using State = typename LatticeType::Value;
 
     static constexpr auto Granularity = GranularityType;
     static constexpr auto Direction = DirectionType;
@@ -30,7 +90,13 @@ public:
 public:
     virtual ~DataflowPass() = default;
 
-    virtual State merge(const std::vector<State> &predecessors) = 0;
+    [[nodiscard]] virtual const Lattice &lattice() const = 0;
+
+    /**
+     * The incoming state of the targets without any neighbours to meet, which are the entry for forward problems and
+     * the exits for backward ones.
+     */
+    virtual State boundary(Function &) { return lattice().top(); }
 
     virtual State initialize(Function &, Target &) = 0;
 
@@ -39,16 +105,16 @@ public:
 
 template <typename T>
 concept DataflowPassConcept = requires {
-    typename T::Result;
+    typename T::Lattice;
     { T::Direction } -> std::convertible_to<DataflowDirection>;
     { T::Granularity } -> std::convertible_to<DataflowGranularity>;
-} && std::is_base_of_v<DataflowPass<typename T::Result, T::Direction, T::Granularity>, T>;
+} && std::is_base_of_v<DataflowPass<typename T::Lattice, T::Direction, T::Granularity>, T>;
 
 template<DataflowPassConcept Pass>
 class DataflowAnalysis {
 public:
     using Key = std::conditional_t<Pass::Granularity == DataflowGranularity::Block, BasicBlock *, Instruction *>;
-    using State = std::unordered_set<typename Pass::Result>;
+    using State = typename Pass::State;
 
 public:
     template<typename... Args>
@@ -60,10 +126,16 @@ public:
 
     [[nodiscard]] auto &in() const { return _in; }
 
+    /**
+     * The number of blocks visited by the last run, including the visits that didn't change anything.
+     */
+    [[nodiscard]] auto iterations() const { return _iterations; }
+
 private:
     std::unordered_map<Key, State> _out{};
     std::unordered_map<Key, State> _in{};
     std::unique_ptr<Pass> _pass;
+    size_t _iterations{};
 };
 
 #include "../../src/il/dataflow.tpp"
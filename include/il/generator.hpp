@@ -1,17 +1,27 @@
 #pragma once
 
+#include "ast/visitor.hpp"
 #include "il/cfg.hpp"
 #include "il/instruction.hpp"
+#include "sem/symbol.hpp"
 #include "sem/type.hpp"
 
 namespace arkoi::il {
 
 class Generator final : ast::Visitor {
-private:
-    Generator() = default;
-
 public:
-    [[nodiscard]] static Module generate(ast::Program &node);
+    explicit Generator(sem::SymbolArena &symbols) : _allocas(symbols.size()), _symbols(symbols) {}
+
+    [[nodiscard]] static Module generate(ast::Program &node, sem::SymbolArena &symbols);
+
+    /**
+     * Lowers a single function, while the labels keep being numbered across all calls. Thus the functions may be
+     * lowered right after each of them was resolved, without the rest of the program being alive.
+     *
+     * @param node The resolved function which is lowered.
+     * @return The lowered function, which is owned by the generator until the next one is lowered.
+     */
+    [[nodiscard]] Function &lower(ast::Function &node);
 
     void visit(ast::Program &node) override;
 
@@ -48,14 +58,16 @@ public:
     [[nodiscard]] auto &module() { return _module; }
 
 private:
-    std::string _make_label_symbol();
+    Name _make_label_symbol();
 
     Variable _make_temporary(const sem::Type &type);
 
     Memory _make_memory(const sem::Type &type);
 
 private:
-    std::unordered_map<std::shared_ptr<Symbol>, Memory> _allocas{};
+    // Indexed by the SymbolId of the variable, as those are unique for the whole compilation.
+    std::vector<std::optional<Memory>> _allocas;
+    sem::SymbolArena &_symbols;
     std::optional<Memory> _return_temp{};
     size_t _temp_index{}, _label_index{};
     Function *_current_function{};
@@ -13,6 +13,8 @@ public:
 public:
     [[nodiscard]] static std::stringstream print(Module &module);
 
+    [[nodiscard]] static std::stringstream print(Function &function);
+
     void visit(Module &module) override;
 
     void visit(Function &function) override;
@@ -23,22 +23,22 @@ public:
 
 class Goto final : public InstructionBase {
 public:
-    explicit Goto(std::string label) : _label(std::move(label)) {}
+    explicit Goto(Name label) : _label(label) {}
 
     void accept(Visitor &visitor) override { visitor.visit(*this); }
 
     [[nodiscard]] bool is_constant() override { return false; }
 
-    [[nodiscard]] auto &label() const { return _label; }
+    [[nodiscard]] auto label() const { return _label; }
 
 private:
-    std::string _label;
+    Name _label;
 };
 
 class If final : public InstructionBase {
 public:
-    If(Operand condition, std::string next, std::string branch)
-        : _next(std::move(next)), _branch(std::move(branch)), _condition(std::move(condition)) {}
+    If(Operand condition, Name next, Name branch)
+        : _next(next), _branch(branch), _condition(std::move(condition)) {}
 
     void accept(Visitor &visitor) override { visitor.visit(*this); }
 
@@ -48,19 +48,19 @@ public:
 
     [[nodiscard]] auto &condition() { return _condition; }
 
-    [[nodiscard]] auto &branch() const { return _branch; }
+    [[nodiscard]] auto branch() const { return _branch; }
 
-    [[nodiscard]] auto &next() const { return _next; }
+    [[nodiscard]] auto next() const { return _next; }
 
 private:
-    std::string _next, _branch;
+    Name _next, _branch;
     Operand _condition;
 };
 
 class Call final : public InstructionBase {
 public:
-    Call(Variable result, std::string name, std::vector<Operand> &&arguments)
-        : _arguments(std::move(arguments)), _name(std::move(name)), _result(std::move(result)) {}
+    Call(Variable result, Name name, std::vector<Operand> &&arguments)
+        : _arguments(std::move(arguments)), _name(name), _result(std::move(result)) {}
 
     void accept(Visitor &visitor) override { visitor.visit(*this); }
 
@@ -74,11 +74,11 @@ public:
 
     [[nodiscard]] auto &result() const { return _result; }
 
-    [[nodiscard]] auto &name() const { return _name; }
+    [[nodiscard]] auto name() const { return _name; }
 
 private:
     std::vector<Operand> _arguments;
-    std::string _name;
+    Name _name;
     Variable _result;
 };
 
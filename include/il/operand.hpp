@@ -1,9 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <variant>
 
 #include "sem/type.hpp"
+#include "utils/string_interner.hpp"
 
 namespace arkoi::il {
 
@@ -34,10 +36,29 @@ private:
     size_t _index;
 };
 
+/**
+ * Numbers the variables of a function densely starting at 0, thus analyses may index flat vectors with it instead of
+ * hashing the variables.
+ */
+class VRegId {
+public:
+    explicit VRegId(uint32_t index) : _index(index) {}
+
+    auto operator<=>(const VRegId &) const = default;
+
+    [[nodiscard]] auto index() const { return _index; }
+
+private:
+    uint32_t _index;
+};
+
+/**
+ * A variable is identified by its virtual register only, the name and version are just kept to print it.
+ */
 class Variable final : public OperandBase {
 public:
-    Variable(std::string name, sem::Type type, size_t version = 0)
-        : _name(std::move(name)), _version(version), _type(std::move(type)) {}
+    Variable(VRegId id, Name name, sem::Type type, size_t version = 0)
+        : _name(name), _version(version), _type(std::move(type)), _id(id) {}
 
     bool operator<(const Variable& rhs) const;
 
@@ -49,12 +70,15 @@ public:
 
     [[nodiscard]] auto version() const { return _version; }
 
-    [[nodiscard]] auto &name() const { return _name; }
+    [[nodiscard]] auto name() const { return _name; }
+
+    [[nodiscard]] auto id() const { return _id; }
 
 private:
-    std::string _name;
+    Name _name;
     size_t _version;
     sem::Type _type;
+    VRegId _id;
 };
 
 struct Immediate final : OperandBase, std::variant<uint64_t, int64_t, uint32_t, int32_t, double, float, bool> {
@@ -26,6 +26,14 @@ class PassManager {
 public:
     void run(il::Module &module) const;
 
+    /**
+     * Runs the passes on a single function until none of them changes it anymore. As the passes only ever transform
+     * one function at a time, this equals running them on the whole module, except that the module hooks are skipped.
+     *
+     * @param function The function which is optimized.
+     */
+    void run(il::Function &function) const;
+
     template<typename Type, typename... Args>
     void add(Args &&... args);
 
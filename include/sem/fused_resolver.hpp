@@ -0,0 +1,102 @@
+#pragma once
+
+#include "ast/arena.hpp"
+#include "ast/nodes.hpp"
+#include "sem/name_resolver.hpp"
+#include "sem/symbol.hpp"
+#include "utils/diagnostics.hpp"
+
+namespace arkoi::sem {
+
+/**
+ * Resolves the names and types of a program in a single traversal after the prototypes, instead of walking every
+ * function body once for the NameResolver and once more for the TypeResolver. The diagnostics are the same as the
+ * ones of both passes, thus the two pass resolution stays available to compare against.
+ */
+class FusedResolver {
+public:
+    /**
+     * Starts the resolution of a program which is handed over in parts, thus the nodes of a part may be destroyed
+     * right after it was defined. Every part has to be declared before the first one is defined.
+     *
+     * @param symbols The arena which owns all symbols afterwards.
+     * @param diagnostics The engine which receives the diagnostics.
+     */
+    FusedResolver(SymbolArena &symbols, DiagnosticEngine &diagnostics);
+
+    /**
+     * Resolves the names and types of the program, where the type diagnostics are only kept if every name was
+     * resolved, as the TypeResolver never runs on a program with unresolved names.
+     *
+     * @param node The program whose names and types are resolved.
+     * @param arena The arena which owns the implicit casts afterwards.
+     * @param symbols The arena which owns all symbols afterwards.
+     * @param diagnostics The engine which receives the diagnostics.
+     */
+    [[nodiscard]] static FusedResolver resolve(ast::Program &node, ast::AstArena &arena, SymbolArena &symbols,
+                                               DiagnosticEngine &diagnostics);
+
+    /**
+     * Resolves the names and types of the function prototypes in the part, which stay global afterwards.
+     *
+     * @param part The part whose prototypes are resolved.
+     * @param arena The arena which owns the nodes of the part.
+     */
+    void declare(ast::Program &part, ast::AstArena &arena);
+
+    /**
+     * Resolves the names and types of the function bodies in the part.
+     *
+     * @param part The part whose bodies are resolved.
+     * @param arena The arena which owns the implicit casts afterwards.
+     */
+    void define(ast::Program &part, ast::AstArena &arena);
+
+    /**
+     * Hands over the type diagnostics once every part is defined, if all names were resolved.
+     */
+    void finish();
+
+    [[nodiscard]] auto has_failed() const { return _names.has_failed() || _types_failed; }
+
+private:
+    // The type diagnostics are held back until it is known whether all names were resolved.
+    DiagnosticEngine _type_diagnostics;
+    DiagnosticEngine &_diagnostics;
+    SymbolArena &_symbols;
+    NameResolver _names;
+    bool _types_failed{};
+};
+
+} // namespace arkoi::sem
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
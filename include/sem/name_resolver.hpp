@@ -1,19 +1,37 @@
 #pragma once
 
-#include <stack>
-
 #include "ast/visitor.hpp"
 #include "front/token.hpp"
 #include "sem/symbol_table.hpp"
+#include "utils/diagnostics.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace arkoi::sem {
 
 class NameResolver final : ast::Visitor {
 private:
-    NameResolver() = default;
+    NameResolver(SymbolArena &symbols, DiagnosticEngine &diagnostics)
+        : _table(symbols), _symbols(symbols), _diagnostics(diagnostics) {}
+
+    NameResolver(SymbolArena &symbols, const SymbolTable &globals, SymbolId slot, DiagnosticEngine &diagnostics)
+        : _table(symbols, globals, slot), _symbols(symbols), _diagnostics(diagnostics) {}
 
 public:
-    [[nodiscard]] static NameResolver resolve(ast::Program &node);
+    [[nodiscard]] static NameResolver resolve(ast::Program &node, SymbolArena &symbols,
+                                              DiagnosticEngine &diagnostics);
+
+    /**
+     * Resolves the prototypes first and afterwards the bodies of the functions in parallel, as those only depend on
+     * the global names. The diagnostics and symbols are merged in source order, thus the result equals the serial
+     * one.
+     *
+     * @param node The program whose names are resolved.
+     * @param symbols The arena which owns all symbols afterwards.
+     * @param diagnostics The engine which receives the diagnostics of all functions.
+     * @param pool The thread pool the function bodies are resolved on.
+     */
+    [[nodiscard]] static NameResolver resolve(ast::Program &node, SymbolArena &symbols,
+                                              DiagnosticEngine &diagnostics, ThreadPool &pool);
 
     [[nodiscard]] auto has_failed() const { return _failed; }
 
@@ -24,6 +42,14 @@ private:
 
     void visit(ast::Function &node) override;
 
+    /**
+     * Opens the scope of the function and declares its parameters, thus its body may be resolved afterwards. The
+     * caller has to exit the scope again.
+     *
+     * @param node The function whose scope is entered.
+     */
+    void _enter_function(ast::Function &node);
+
     void visit(ast::Block &node) override;
 
     void visit(ast::Parameter &) override;
@@ -47,13 +73,21 @@ private:
     void visit(ast::If &node) override;
 
     template<typename Type, typename... Args>
-    [[nodiscard]] std::shared_ptr<Symbol> _check_non_existence(const front::Token &token, Args &&... args);
+    [[nodiscard]] std::optional<SymbolId> _check_non_existence(const front::Token &token, Args &&... args);
 
     template<typename... Types>
-    [[nodiscard]] std::shared_ptr<Symbol> _check_existence(const front::Token &token);
+    [[nodiscard]] std::optional<SymbolId> _check_existence(const front::Token &token);
+
+    void _report(Diagnostic::Code code, const front::Token &token);
 
 private:
-    std::stack<std::shared_ptr<SymbolTable>> _scopes{};
+    friend class ast::Node;
+    friend class FusedResolver;
+    friend class TypeResolver;
+
+    SymbolTable _table;
+    SymbolArena &_symbols;
+    DiagnosticEngine &_diagnostics;
     bool _failed{};
 };
 
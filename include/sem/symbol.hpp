@@ -1,23 +1,47 @@
 #pragma once
 
-#include <memory>
+#include <cstdint>
+#include <optional>
+#include <ostream>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include "sem/type.hpp"
+#include "utils/string_interner.hpp"
 
 struct Symbol;
 
 namespace arkoi::sem {
 
-class Variable;
+/**
+ * A handle to a symbol stored in a SymbolArena.
+ */
+class SymbolId {
+public:
+    explicit SymbolId(uint32_t index) : _index(index) {}
+
+    auto operator<=>(const SymbolId &) const = default;
+
+    [[nodiscard]] auto index() const { return _index; }
+
+private:
+    uint32_t _index;
+};
 
 class Function {
 public:
-    explicit Function(std::string name) : _name(std::move(name)) {}
+    explicit Function(Name name) : _name(name) {}
 
     [[nodiscard]] auto &parameters() const { return _parameters; }
-    void set_parameters(std::vector<std::shared_ptr<Variable>> &&symbols) { _parameters = std::move(symbols); }
+    void set_parameters(std::vector<SymbolId> &&symbols) { _parameters = std::move(symbols); }
+
+    /**
+     * The types of the parameters are part of the prototype, while the parameter symbols are only declared together
+     * with the body. Thus calls may be checked against functions whose bodies weren't resolved yet.
+     */
+    [[nodiscard]] auto &parameter_types() const { return _parameter_types; }
+    void set_parameter_types(std::vector<Type> &&types) { _parameter_types = std::move(types); }
 
     [[nodiscard]] auto &name() const { return _name; }
 
@@ -25,16 +49,17 @@ public:
     void set_return_type(Type type) { _return_type = type; }
 
 private:
-    std::vector<std::shared_ptr<Variable>> _parameters{};
+    std::vector<SymbolId> _parameters{};
+    std::vector<Type> _parameter_types{};
     std::optional<Type> _return_type{};
-    std::string _name;
+    Name _name;
 };
 
 class Variable {
 public:
-    Variable(std::string name, Type type) : _type(type), _name(std::move(name)) {}
+    Variable(Name name, Type type) : _type(type), _name(name) {}
 
-    explicit Variable(std::string name) : _name(std::move(name)) {}
+    explicit Variable(Name name) : _name(name) {}
 
     [[nodiscard]] auto &type() const { return _type.value(); }
     void set_type(Type type) { _type = type; }
@@ -43,7 +68,7 @@ public:
 
 private:
     std::optional<Type> _type{};
-    std::string _name;
+    Name _name;
 };
 
 } // namespace arkoi::sem
@@ -52,7 +77,48 @@ struct Symbol : std::variant<arkoi::sem::Function, arkoi::sem::Variable> {
     using variant::variant;
 };
 
-std::ostream &operator<<(std::ostream &os, const std::shared_ptr<Symbol> &symbol);
+std::ostream &operator<<(std::ostream &os, const Symbol &symbol);
+
+namespace arkoi::sem {
+
+/**
+ * Owns every symbol of a compilation in a single contiguous vector, which is indexed by a SymbolId. References into
+ * the arena are invalidated as soon as another symbol is made.
+ *
+ * The arena is not synchronized. To fill it from multiple threads, slots are reserved up front and every thread only
+ * replaces the slots it was handed with make_at().
+ */
+class SymbolArena {
+public:
+    template<typename Type, typename... Args>
+    [[nodiscard]] SymbolId make(Args &&... args);
+
+    /**
+     * Replaces the symbol in a slot, which was previously reserved.
+     */
+    template<typename Type, typename... Args>
+    void make_at(SymbolId id, Args &&... args);
+
+    /**
+     * Appends the given amount of placeholder slots, which are replaced with make_at() afterwards.
+     *
+     * @return The id of the first reserved slot.
+     */
+    SymbolId reserve(size_t count);
+
+    [[nodiscard]] Symbol &operator[](SymbolId id) { return _symbols[id.index()]; }
+
+    [[nodiscard]] const Symbol &operator[](SymbolId id) const { return _symbols[id.index()]; }
+
+    [[nodiscard]] size_t size() const { return _symbols.size(); }
+
+private:
+    std::vector<Symbol> _symbols{};
+};
+
+#include "../../src/sem/symbol.tpp"
+
+} // namespace arkoi::sem
 
 //==============================================================================
 // BSD 3-Clause License
@@ -1,38 +1,84 @@
 #pragma once
 
-#include <memory>
+#include <cstdint>
+#include <optional>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "sem/symbol.hpp"
 
 namespace arkoi::sem {
 
+/**
+ * A single flat symbol table for a whole compilation.
+ *
+ * Every interned name indexes a stack of the symbols currently shadowing each other, the innermost one on top. Scopes
+ * are entered and exited with a watermark into the list of declared names, thus entering a scope doesn't allocate
+ * anything and a lookup only touches the stack of the looked up name. The symbols themselves are made in the given
+ * SymbolArena.
+ *
+ * A table nested in a global one only sees a batch of functions, thus it numbers just the names declared in it instead
+ * of growing to the largest name of the whole program.
+ */
 class SymbolTable {
 public:
-    explicit SymbolTable(std::shared_ptr<SymbolTable> parent = nullptr) : _parent(std::move(parent)) {}
+    explicit SymbolTable(SymbolArena &symbols) : _symbols(symbols) {}
 
+    /**
+     * Creates a table that is nested in the given global one, which is only read. The inserted symbols are made in
+     * the slots reserved from the given one onwards, thus multiple of those tables may be filled in parallel.
+     */
+    SymbolTable(SymbolArena &symbols, const SymbolTable &globals, SymbolId slot)
+        : _symbols(symbols), _globals(&globals), _slot(slot) {}
+
+    void enter_scope();
+
+    /**
+     * Removes every symbol that was declared since the matching enter_scope().
+     */
+    void exit_scope();
+
+    /**
+     * @return The new symbol, or std::nullopt if the name is already taken in the current scope.
+     */
     template<typename Type, typename... Args>
-    std::shared_ptr<Symbol> &insert(const std::string &name, Args &&... args);
+    std::optional<SymbolId> insert(const Name &name, Args &&... args);
 
+    /**
+     * @return The innermost visible symbol of one of the given types, or std::nullopt if there is none.
+     */
     template<typename... Types>
-    [[nodiscard]] std::shared_ptr<Symbol> &lookup(const std::string &name);
+    [[nodiscard]] std::optional<SymbolId> lookup(const Name &name) const;
+
+    [[nodiscard]] auto depth() const { return _watermarks.size(); }
 
 private:
-    std::unordered_map<std::string, std::shared_ptr<Symbol>> _symbols{};
-    std::shared_ptr<SymbolTable> _parent;
-};
+    /**
+     * Gets the index of the stack of the name in "_shadows", which is created if it doesn't exist yet.
+     */
+    [[nodiscard]] uint32_t _index(const Name &name);
 
-class IdentifierAlreadyTaken final : public std::runtime_error {
-public:
-    explicit IdentifierAlreadyTaken(const std::string &name)
-        : std::runtime_error("The identifier " + name + " is already taken.") {}
-};
+    /**
+     * Finds the index of the stack of the name in "_shadows", if the name was ever declared in this table.
+     */
+    [[nodiscard]] std::optional<uint32_t> _find(const Name &name) const;
 
-class IdentifierNotFound final : public std::runtime_error {
-public:
-    explicit IdentifierNotFound(const std::string &name)
-        : std::runtime_error("The identifier " + name + " was not found.") {}
+private:
+    struct Entry {
+        SymbolId symbol;
+        size_t depth;
+    };
+
+private:
+    // Only the names declared in a batch table are numbered, as those are few compared to the whole program.
+    std::unordered_map<uint32_t, uint32_t> _indices{};
+    std::vector<std::vector<Entry>> _shadows{};
+    std::vector<uint32_t> _declared{};
+    std::vector<size_t> _watermarks{};
+    SymbolArena &_symbols;
+    const SymbolTable *_globals{};
+    std::optional<SymbolId> _slot{};
 };
 
 #include "../../src/sem/symbol_table.tpp"
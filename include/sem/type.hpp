@@ -1,66 +1,160 @@
 #pragma once
 
+#include <array>
+#include <bit>
 #include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string_view>
+#include <utility>
 
 #include "utils/size.hpp"
 
 namespace arkoi::sem {
 
-class TypeBase {
-public:
-    virtual ~TypeBase() = default;
-
-    [[nodiscard]] virtual Size size() const = 0;
-};
-
-class Integral final : public TypeBase {
+class Integral {
 public:
     constexpr Integral(const Size size, const bool sign) : _size(size), _sign(sign) {}
 
-    [[nodiscard]] Size size() const override { return _size; }
+    [[nodiscard]] constexpr Size size() const { return _size; }
 
-    bool operator==(const Integral &other) const;
-
-    bool operator!=(const Integral &other) const;
+    [[nodiscard]] constexpr bool sign() const { return _sign; }
 
     [[nodiscard]] uint64_t max() const;
 
-    [[nodiscard]] auto sign() const { return _sign; }
+    bool operator==(const Integral &other) const = default;
 
 private:
     Size _size;
     bool _sign;
 };
 
-class Floating final : public TypeBase {
+class Floating {
 public:
-    explicit Floating(const Size size) : _size(size) {}
-
-    [[nodiscard]] Size size() const override { return _size; }
+    constexpr explicit Floating(const Size size) : _size(size) {}
 
-    bool operator==(const Floating &other) const;
+    [[nodiscard]] constexpr Size size() const { return _size; }
 
-    bool operator!=(const Floating &other) const;
+    bool operator==(const Floating &other) const = default;
 
 private:
     Size _size;
 };
 
-class Boolean final : public TypeBase {
+class Boolean {
 public:
-    [[nodiscard]] Size size() const override { return Size::BYTE; }
+    [[nodiscard]] constexpr Size size() const { return Size::BYTE; }
 
-    bool operator==(const Boolean &other) const;
+    bool operator==(const Boolean &other) const = default;
+};
 
-    bool operator!=(const Boolean &other) const;
+/**
+ * Every primitive type interned into a single byte. The integral ones are ordered by their size and sign, thus their
+ * id can be computed instead of looked up.
+ */
+enum class TypeId : uint8_t {
+    U8,
+    S8,
+    U16,
+    S16,
+    U32,
+    S32,
+    U64,
+    S64,
+    F32,
+    F64,
+    Bool,
 };
 
-struct Type final : TypeBase, std::variant<Integral, Floating, Boolean> {
-    using variant::variant;
+enum class RegisterClass : uint8_t {
+    General,
+    Floating,
+};
+
+class Type {
+public:
+    enum class Kind : uint8_t {
+        Integral,
+        Floating,
+        Boolean,
+    };
+
+    struct Info {
+        std::string_view name;
+        Kind kind;
+        Size size;
+        bool sign;
+        uint64_t max;
+        RegisterClass register_class;
+    };
+
+public:
+    constexpr Type(TypeId id) : _id(id) {}
+
+    constexpr Type(Integral type);
+
+    constexpr Type(Floating type);
+
+    constexpr Type(Boolean) : _id(TypeId::Bool) {}
 
-    [[nodiscard]] Size size() const override;
+    bool operator==(const Type &other) const = default;
+
+    [[nodiscard]] constexpr TypeId id() const { return _id; }
+
+    [[nodiscard]] constexpr const Info &info() const;
+
+    [[nodiscard]] constexpr Kind kind() const { return info().kind; }
+
+    [[nodiscard]] constexpr Size size() const { return info().size; }
+
+    [[nodiscard]] constexpr bool sign() const { return info().sign; }
+
+    /**
+     * @return The maximum value of an integral type, or 0 for all other ones.
+     */
+    [[nodiscard]] constexpr uint64_t max() const { return info().max; }
+
+    [[nodiscard]] constexpr RegisterClass register_class() const { return info().register_class; }
+
+    [[nodiscard]] constexpr bool is_integral() const { return kind() == Kind::Integral; }
+
+    [[nodiscard]] constexpr bool is_floating() const { return kind() == Kind::Floating; }
+
+    [[nodiscard]] constexpr bool is_boolean() const { return kind() == Kind::Boolean; }
+
+    /**
+     * Calls the visitor with the Integral, Floating or Boolean view of this type.
+     */
+    template<typename Visitor>
+    constexpr decltype(auto) visit(Visitor &&visitor) const;
+
+private:
+    TypeId _id;
 };
 
+// Indexed by the TypeId, thus the order has to match.
+inline constexpr std::array<Type::Info, 11> TYPE_INFOS{{
+    {"u8", Type::Kind::Integral, Size::BYTE, false, std::numeric_limits<uint8_t>::max(), RegisterClass::General},
+    {"s8", Type::Kind::Integral, Size::BYTE, true, std::numeric_limits<int8_t>::max(), RegisterClass::General},
+    {"u16", Type::Kind::Integral, Size::WORD, false, std::numeric_limits<uint16_t>::max(), RegisterClass::General},
+    {"s16", Type::Kind::Integral, Size::WORD, true, std::numeric_limits<int16_t>::max(), RegisterClass::General},
+    {"u32", Type::Kind::Integral, Size::DWORD, false, std::numeric_limits<uint32_t>::max(), RegisterClass::General},
+    {"s32", Type::Kind::Integral, Size::DWORD, true, std::numeric_limits<int32_t>::max(), RegisterClass::General},
+    {"u64", Type::Kind::Integral, Size::QWORD, false, std::numeric_limits<uint64_t>::max(), RegisterClass::General},
+    {"s64", Type::Kind::Integral, Size::QWORD, true, std::numeric_limits<int64_t>::max(), RegisterClass::General},
+    {"f32", Type::Kind::Floating, Size::DWORD, false, 0, RegisterClass::Floating},
+    {"f64", Type::Kind::Floating, Size::QWORD, false, 0, RegisterClass::Floating},
+    {"bool", Type::Kind::Boolean, Size::BYTE, false, 0, RegisterClass::General},
+}};
+
+/**
+ * Calls the visitor with the views of both types, which allows to match on pairs of types.
+ */
+template<typename Visitor>
+constexpr decltype(auto) visit(Visitor &&visitor, Type first, Type second);
+
+#include "../../src/sem/type.tpp"
+
 } // namespace arkoi::sem
 
 std::ostream &operator<<(std::ostream &os, const arkoi::sem::Integral &type);
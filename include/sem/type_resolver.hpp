@@ -1,16 +1,37 @@
 #pragma once
 
+#include "ast/arena.hpp"
 #include "ast/nodes.hpp"
+#include "sem/name_resolver.hpp"
+#include "sem/symbol.hpp"
 #include "sem/type.hpp"
+#include "utils/diagnostics.hpp"
+#include "utils/thread_pool.hpp"
 
 namespace arkoi::sem {
 
 class TypeResolver final : ast::Visitor {
 private:
-    TypeResolver() = default;
+    TypeResolver(ast::AstArena &arena, SymbolArena &symbols, DiagnosticEngine &diagnostics)
+        : _diagnostics(diagnostics), _symbols(symbols), _arena(arena) {}
 
 public:
-    [[nodiscard]] static TypeResolver resolve(ast::Program &node);
+    [[nodiscard]] static TypeResolver resolve(ast::Program &node, ast::AstArena &arena, SymbolArena &symbols,
+                                              DiagnosticEngine &diagnostics);
+
+    /**
+     * Resolves the prototypes first and afterwards the bodies of the functions in parallel, as those only read the
+     * signatures of the called functions. The diagnostics and nodes are merged in source order, thus the result
+     * equals the serial one.
+     *
+     * @param node The program whose types are resolved.
+     * @param arena The arena which owns the implicit casts afterwards.
+     * @param symbols The arena of the already name resolved symbols.
+     * @param diagnostics The engine which receives the diagnostics of all functions.
+     * @param pool The thread pool the function bodies are resolved on.
+     */
+    [[nodiscard]] static TypeResolver resolve(ast::Program &node, ast::AstArena &arena, SymbolArena &symbols,
+                                              DiagnosticEngine &diagnostics, ThreadPool &pool);
 
     void visit(ast::Program &node) override;
 
@@ -53,10 +74,30 @@ private:
 
     static bool _can_implicit_convert(const Type &from, const Type &destination);
 
-    static std::unique_ptr<ast::Node> _cast(std::unique_ptr<ast::Node> &node, const Type &from, const Type &to);
+    [[nodiscard]] ast::Node *_cast(ast::Node *node, const Type &from, const Type &to);
+
+    void _report(Diagnostic::Code code, std::optional<Span> span = std::nullopt);
+
+    [[nodiscard]] static Span _span(const front::Token &token);
+
+    /**
+     * Once a name couldn't be resolved the types are meaningless, thus the fused resolver only resolves the names of
+     * the remaining nodes.
+     *
+     * @param node The node which is about to be visited.
+     * @return True if the node was handed to the name resolver and mustn't be visited any further.
+     */
+    [[nodiscard]] bool _delegate(ast::Node &node);
 
 private:
+    friend class FusedResolver;
+
+    // Only set by the fused resolver, which resolves the names right before the types of each node.
+    NameResolver *_names{};
     std::optional<Type> _current_type{}, _return_type{};
+    DiagnosticEngine &_diagnostics;
+    SymbolArena &_symbols;
+    ast::AstArena &_arena;
     bool _failed{};
 };
 
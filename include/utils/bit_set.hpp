@@ -0,0 +1,116 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * A dense set over the indices [0, size), stored as one bit per index. Merging, subtracting and comparing two sets
+ * works on whole words, thus it is cheap as long as the universe is not much larger than the set.
+ */
+class BitSet {
+public:
+    explicit BitSet(size_t size = 0) : _words((size + 63) / 64, 0), _size(size) {}
+
+    void set(size_t index);
+
+    void reset(size_t index);
+
+    [[nodiscard]] bool test(size_t index) const;
+
+    BitSet &operator|=(const BitSet &other);
+
+    BitSet &operator&=(const BitSet &other);
+
+    BitSet &operator-=(const BitSet &other);
+
+    bool operator==(const BitSet &other) const = default;
+
+    [[nodiscard]] size_t count() const;
+
+    [[nodiscard]] bool empty() const;
+
+    [[nodiscard]] auto size() const { return _size; }
+
+    /**
+     * Calls the callback with every index in the set in ascending order.
+     */
+    template<typename Callback>
+    void for_each(Callback &&callback) const;
+
+private:
+    std::vector<uint64_t> _words;
+    size_t _size;
+};
+
+/**
+ * The same set as BitSet, but only the words containing at least one index are stored, sorted by their position.
+ * Used for huge functions, where a dense set per instruction would be quadratic in memory.
+ */
+class SparseBitSet {
+public:
+    explicit SparseBitSet(size_t size = 0) : _size(size) {}
+
+    void set(size_t index);
+
+    void reset(size_t index);
+
+    [[nodiscard]] bool test(size_t index) const;
+
+    SparseBitSet &operator|=(const SparseBitSet &other);
+
+    SparseBitSet &operator&=(const SparseBitSet &other);
+
+    SparseBitSet &operator-=(const SparseBitSet &other);
+
+    bool operator==(const SparseBitSet &other) const = default;
+
+    [[nodiscard]] size_t count() const;
+
+    [[nodiscard]] bool empty() const { return _words.empty(); }
+
+    [[nodiscard]] auto size() const { return _size; }
+
+    template<typename Callback>
+    void for_each(Callback &&callback) const;
+
+private:
+    // Pairs of the word position and the word, never containing a zero word.
+    std::vector<std::pair<size_t, uint64_t>> _words;
+    size_t _size;
+};
+
+#include "../../src/utils/bit_set.tpp"
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
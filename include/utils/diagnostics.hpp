@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "utils/line_table.hpp"
+
+/**
+ * The location of a diagnostic, pointing at the bytes of the source which caused it.
+ */
+struct Span {
+    uint32_t offset, length;
+};
+
+/**
+ * A single error reported by one of the compiler stages.
+ *
+ * Only the code and the arguments of the message are stored, the message
+ * itself is put together once the diagnostic gets rendered.
+ */
+class Diagnostic {
+public:
+    enum class Code {
+        UnexpectedEndOfLine,
+        UnexpectedChar,
+        UnknownChar,
+        NumberOutOfRange,
+        Misindentation,
+        UnexpectedEndOfTokens,
+        UnexpectedToken,
+        IdentifierAlreadyTaken,
+        IdentifierNotFound,
+        InvalidVariableType,
+        InvalidReturnType,
+        InvalidCast,
+        InvalidAssignType,
+        ArgumentCountMismatch,
+        InvalidArgumentType,
+        InvalidConditionType,
+    };
+
+public:
+    Diagnostic(Code code, std::optional<Span> span, std::vector<std::string> args = {})
+        : _args(std::move(args)), _span(span), _code(code) {}
+
+    [[nodiscard]] std::string message() const;
+
+    [[nodiscard]] auto &args() const { return _args; }
+
+    [[nodiscard]] auto &span() const { return _span; }
+
+    [[nodiscard]] auto code() const { return _code; }
+
+private:
+    std::vector<std::string> _args;
+    std::optional<Span> _span;
+    Code _code;
+};
+
+/**
+ * Collects the diagnostics of the scanner, parser and resolvers in the order
+ * they were reported.
+ *
+ * Once the limit of diagnostics is reached every further one is dropped, and
+ * the stages stop as early as possible.
+ */
+class DiagnosticEngine {
+public:
+    /**
+     * @param limit The maximum amount of diagnostics, where 0 means no limit.
+     */
+    explicit DiagnosticEngine(size_t limit = 0) : _limit(limit) {}
+
+    void report(Diagnostic diagnostic);
+
+    /**
+     * Appends the diagnostics of the other engine, e.g. the one of a chunk
+     * which was parsed on its own.
+     */
+    void absorb(DiagnosticEngine &&other);
+
+    /**
+     * Prints every diagnostic, where the spans are resolved to rows and columns with the line table of the source.
+     */
+    void render(std::ostream &os, const LineTable &lines) const;
+
+    [[nodiscard]] bool is_full() const;
+
+    [[nodiscard]] bool has_errors() const { return !_diagnostics.empty(); }
+
+    [[nodiscard]] auto &diagnostics() const { return _diagnostics; }
+
+    [[nodiscard]] auto limit() const { return _limit; }
+
+private:
+    std::vector<Diagnostic> _diagnostics{};
+    size_t _limit;
+};
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
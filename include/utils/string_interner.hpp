@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * Maps every distinct string to a dense 32-bit id and back.
+ *
+ * Identifiers, labels and symbol names are interned once and afterwards only
+ * compared and hashed by their id. The interned strings are kept in a deque,
+ * so the views handed out by lookup() stay valid for the lifetime of the
+ * interner, and all operations are safe to call from multiple threads.
+ */
+class StringInterner {
+public:
+    StringInterner();
+
+    StringInterner(const StringInterner &) = delete;
+
+    StringInterner &operator=(const StringInterner &) = delete;
+
+    /**
+     * Returns the id of the given string, assigning the next free one if the
+     * string was never seen before. The empty string always has the id 0.
+     *
+     * @param value The string to intern.
+     * @return The id which is shared by every equal string.
+     */
+    [[nodiscard]] uint32_t intern(std::string_view value);
+
+    /**
+     * Returns the string that was interned under the given id.
+     *
+     * @param id An id previously returned by intern().
+     * @return A view into the interner, which stays valid as long as the interner.
+     */
+    [[nodiscard]] std::string_view lookup(uint32_t id) const;
+
+    [[nodiscard]] size_t size() const;
+
+    [[nodiscard]] static StringInterner &global();
+
+private:
+    std::unordered_map<std::string_view, uint32_t> _ids{};
+    std::deque<std::string> _strings{};
+    mutable std::shared_mutex _mutex{};
+};
+
+/**
+ * A string interned in the global StringInterner.
+ *
+ * Comparing and hashing a name only touches its id, the actual characters
+ * are only looked up again when printing the IL or assembly.
+ */
+class Name {
+public:
+    Name() = default;
+
+    explicit Name(std::string_view value) : _id(StringInterner::global().intern(value)) {}
+
+    auto operator<=>(const Name &) const = default;
+
+    [[nodiscard]] std::string_view view() const { return StringInterner::global().lookup(_id); }
+
+    [[nodiscard]] auto id() const { return _id; }
+
+private:
+    uint32_t _id{};
+};
+
+namespace std {
+
+template<>
+struct hash<Name> {
+    size_t operator()(const Name &name) const noexcept { return std::hash<uint32_t>{}(name.id()); }
+};
+
+} // namespace std
+
+std::ostream &operator<<(std::ostream &os, const Name &name);
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <memory>
 #include <sstream>
 
 #include "il/instruction.hpp"
@@ -18,11 +19,28 @@ class Generator final : il::Visitor {
 public:
     explicit Generator(il::Module &module);
 
+    /**
+     * Starts an empty assembly output, to which the functions are added one at a time using generate.
+     */
+    Generator();
+
+    void generate(il::Function &function);
+
     [[nodiscard]] std::stringstream output() const;
 
+    /**
+     * Returns the text generated since the last call and forgets it, thus the text of the functions that were already
+     * written out isn't kept alive. The data section has to be taken last, as it always follows the text.
+     */
+    [[nodiscard]] std::stringstream take_text();
+
+    [[nodiscard]] std::stringstream take_data();
+
 private:
     void visit(il::Module &module) override;
 
+    void _prologue();
+
     void visit(il::Function &function) override;
 
     void visit(il::BasicBlock &block) override;
@@ -93,13 +111,13 @@ private:
 
     static void _directive(const std::string &directive, std::vector<AssemblyItem> &output);
 
-    void _label(const std::string &name);
+    void _label(std::string_view name);
 
-    void _jmp(const std::string &name);
+    void _jmp(std::string_view name);
 
-    void _jnz(const std::string &name);
+    void _jnz(std::string_view name);
 
-    void _call(const std::string &name);
+    void _call(std::string_view name);
 
     void _movsxd(const Operand &destination, const Operand &source);
 
@@ -190,7 +208,6 @@ private:
     std::vector<AssemblyItem> _data{};
     std::vector<AssemblyItem> _text{};
     size_t _constants{};
-    il::Module &_module;
 };
 
 } // namespace arkoi::x86_64
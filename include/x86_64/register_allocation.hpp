@@ -18,17 +18,16 @@ public:
     [[nodiscard]] auto &spilled() { return _spilled; }
 
 private:
-    void _renumber();
-
+    template<typename Set>
     void _build();
 
     void _simplify();
 
 private:
-    il::DataflowAnalysis<il::InstructionLivenessAnalysis> _analysis;
     InterferenceGraph<il::Variable> _graph;
     std::vector<il::Variable> _spilled;
     il::Function &_function;
+    il::OperandIndex _operands;
     Mapping _assigned;
 };
 } // namespace arkoi::x86_64
@@ -0,0 +1,95 @@
+#include "ast/arena.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+using namespace arkoi::ast;
+
+AstArena::~AstArena() {
+    // Objects are destroyed in the reverse order of their creation, thus parents go before their children.
+    for (auto *current = _destructors; current; current = current->previous) {
+        current->destroy(current->object, current->count);
+    }
+}
+
+void AstArena::absorb(AstArena &&other) {
+    if (other._destructors) {
+        // The absorbed objects are treated as newer ones, thus they are destroyed before the ones of this arena.
+        auto *oldest = other._destructors;
+        while (oldest->previous) oldest = oldest->previous;
+
+        oldest->previous = _destructors;
+        _destructors = other._destructors;
+    }
+
+    _chunks.insert(_chunks.end(), std::make_move_iterator(other._chunks.begin()),
+                   std::make_move_iterator(other._chunks.end()));
+    _allocated += other._allocated;
+
+    other._chunks.clear();
+    other._current = other._end = nullptr;
+    other._destructors = nullptr;
+    other._allocated = 0;
+}
+
+static std::byte *align(std::byte *pointer, size_t alignment) {
+    const auto address = reinterpret_cast<uintptr_t>(pointer);
+    return reinterpret_cast<std::byte *>((address + alignment - 1) & ~(alignment - 1));
+}
+
+void *AstArena::_allocate(size_t size, size_t alignment) {
+    // Oversized requests get a chunk of their own, so the space left in the current chunk isn't thrown away.
+    if (size + alignment > CHUNK_SIZE) {
+        auto &chunk = _chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(size + alignment));
+        _allocated += size + alignment;
+        return align(chunk.get(), alignment);
+    }
+
+    auto *aligned = align(_current, alignment);
+    if (!_current || reinterpret_cast<uintptr_t>(aligned) + size > reinterpret_cast<uintptr_t>(_end)) {
+        const auto chunk_size = std::max(_chunk_size, size + alignment);
+        _chunk_size = std::min(_chunk_size * 2, CHUNK_SIZE);
+
+        auto &chunk = _chunks.emplace_back(std::make_unique_for_overwrite<std::byte[]>(chunk_size));
+        _current = chunk.get();
+        _end = chunk.get() + chunk_size;
+        _allocated += chunk_size;
+
+        aligned = align(_current, alignment);
+    }
+
+    _current = aligned + size;
+    return aligned;
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,63 @@
+template<typename Type, typename... Args>
+Type *AstArena::make(Args &&... args) {
+    auto *memory = _allocate(sizeof(Type), alignof(Type));
+    auto *object = new(memory) Type(std::forward<Args>(args)...);
+
+    _register(object, 1);
+
+    return object;
+}
+
+template<typename Type>
+std::span<Type> AstArena::make_span(std::vector<Type> &&elements) {
+    if (elements.empty()) return {};
+
+    auto *memory = static_cast<Type *>(_allocate(sizeof(Type) * elements.size(), alignof(Type)));
+    std::uninitialized_move(elements.begin(), elements.end(), memory);
+
+    _register(memory, elements.size());
+
+    return {memory, elements.size()};
+}
+
+template<typename Type>
+void AstArena::_register(Type *object, size_t count) {
+    // Trivially destructible objects, like the child pointer arrays, are released together with their chunk.
+    if constexpr (!std::is_trivially_destructible_v<Type>) {
+        auto *memory = _allocate(sizeof(Destructor), alignof(Destructor));
+
+        auto destroy = [](void *object, size_t count) { std::destroy_n(static_cast<Type *>(object), count); };
+        _destructors = new(memory) Destructor{destroy, _destructors, object, count};
+    }
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,58 @@
+template<typename Visitor>
+decltype(auto) Node::accept(Visitor &visitor) {
+    switch (_tag) {
+        case Tag::Program: return visitor.visit(static_cast<Program &>(*this));
+        case Tag::Block: return visitor.visit(static_cast<Block &>(*this));
+        case Tag::Identifier: return visitor.visit(static_cast<Identifier &>(*this));
+        case Tag::Parameter: return visitor.visit(static_cast<Parameter &>(*this));
+        case Tag::Function: return visitor.visit(static_cast<Function &>(*this));
+        case Tag::Return: return visitor.visit(static_cast<Return &>(*this));
+        case Tag::If: return visitor.visit(static_cast<If &>(*this));
+        case Tag::Assign: return visitor.visit(static_cast<Assign &>(*this));
+        case Tag::Variable: return visitor.visit(static_cast<Variable &>(*this));
+        case Tag::Call: return visitor.visit(static_cast<Call &>(*this));
+        case Tag::Immediate: return visitor.visit(static_cast<Immediate &>(*this));
+        case Tag::Binary: return visitor.visit(static_cast<Binary &>(*this));
+        case Tag::Cast: return visitor.visit(static_cast<Cast &>(*this));
+    }
+
+    // As the -Wswitch flag is set, this will never be reached.
+    std::unreachable();
+}
+
+template<typename Type>
+Type *node_cast(Node *node) {
+    if (node->tag() != Type::TAG) return nullptr;
+    return static_cast<Type *>(node);
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,167 @@
+#include "front/document.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "front/parser.hpp"
+#include "front/scanner.hpp"
+
+using namespace arkoi::front;
+using namespace arkoi;
+
+Document::Document(std::string_view text) {
+    for (const auto &chunk: Scanner::split(text, 0)) {
+        if (chunk.data.empty()) continue;
+        _chunks.push_back(_parse(chunk.data));
+    }
+}
+
+size_t Document::apply(const TextEdit &edit) {
+    const auto edit_end = edit.offset + edit.length;
+
+    // An insertion right at the boundary of two chunks is appended to the first one.
+    size_t first = 0, begin = 0;
+    while (first < _chunks.size() && begin + _chunks[first]->text.size() < edit.offset) {
+        begin += _chunks[first]->text.size();
+        first++;
+    }
+
+    size_t last = first, end = begin;
+    while (last < _chunks.size() && (last == first || end < edit_end)) {
+        end += _chunks[last]->text.size();
+        last++;
+    }
+
+    if (edit_end > end) throw std::out_of_range("The edit exceeds the document.");
+
+    std::string text;
+    for (auto index = first; index < last; index++) text += _chunks[index]->text;
+    text.replace(edit.offset - begin, edit.length, edit.replacement);
+
+    // The edited text must again start at a top-level function and end in front of one, otherwise the neighbours
+    // are merged in, just like splitting the whole text would have done.
+    while (!text.empty()) {
+        if (first > 0 && !Scanner::is_function_start(text)) {
+            text.insert(0, _chunks[--first]->text);
+        } else if (last < _chunks.size() && text.back() != '\n') {
+            text += _chunks[last++]->text;
+        } else {
+            break;
+        }
+    }
+
+    std::vector<std::unique_ptr<Chunk>> parsed;
+    for (const auto &chunk: Scanner::split(text, 0)) {
+        if (chunk.data.empty()) continue;
+        parsed.push_back(_parse(chunk.data));
+    }
+
+    const auto reparsed = parsed.size();
+    _chunks.erase(_chunks.begin() + static_cast<ptrdiff_t>(first), _chunks.begin() + static_cast<ptrdiff_t>(last));
+    _chunks.insert(_chunks.begin() + static_cast<ptrdiff_t>(first), std::make_move_iterator(parsed.begin()),
+                   std::make_move_iterator(parsed.end()));
+
+    return reparsed;
+}
+
+ast::Program Document::program() {
+    _statements.clear();
+    for (const auto &chunk: _chunks) {
+        _statements.insert(_statements.end(), chunk->statements.begin(), chunk->statements.end());
+    }
+
+    return ast::Program(_statements);
+}
+
+std::vector<Token> Document::tokens() const {
+    std::vector<Token> tokens;
+
+    uint32_t start = 0;
+    for (const auto &chunk: _chunks) {
+        // Every chunk is terminated by its own End Of File token.
+        for (auto token = chunk->tokens.begin(); token != chunk->tokens.end() - 1; ++token) {
+            tokens.push_back(token->shifted(start));
+        }
+
+        start += static_cast<uint32_t>(chunk->text.size());
+    }
+
+    tokens.emplace_back(Token::Type::EndOfFile, start, "");
+    return tokens;
+}
+
+std::string Document::text() const {
+    std::string text;
+    for (const auto &chunk: _chunks) text += chunk->text;
+    return text;
+}
+
+bool Document::has_failed() const {
+    return std::ranges::any_of(_chunks, [](const auto &chunk) { return chunk->failed; });
+}
+
+std::vector<Diagnostic> Document::diagnostics() const {
+    std::vector<Diagnostic> diagnostics;
+
+    uint32_t start = 0;
+    for (const auto &chunk: _chunks) {
+        for (const auto &diagnostic: chunk->diagnostics.diagnostics()) {
+            auto span = diagnostic.span();
+            if (span) span->offset += start;
+
+            diagnostics.emplace_back(diagnostic.code(), span, diagnostic.args());
+        }
+
+        start += static_cast<uint32_t>(chunk->text.size());
+    }
+
+    return diagnostics;
+}
+
+std::unique_ptr<Document::Chunk> Document::_parse(std::string_view text) const {
+    auto chunk = std::make_unique<Chunk>();
+
+    // The tokens and nodes point into the text of their chunk, which is never modified afterwards.
+    chunk->text = text;
+
+    Scanner scanner(chunk->text, chunk->diagnostics);
+    chunk->tokens = scanner.tokenize();
+
+    Parser parser(std::vector(chunk->tokens), chunk->arena, chunk->diagnostics);
+    chunk->statements = parser.parse_program_statements();
+    chunk->failed = scanner.has_failed() || parser.has_failed();
+
+    return chunk;
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
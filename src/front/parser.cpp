@@ -1,13 +1,156 @@
 #include "front/parser.hpp"
 
-#include "sem/symbol_table.hpp"
+#include <array>
+#include <future>
+#include <tuple>
 
 using namespace arkoi::front;
 using namespace arkoi;
 
+static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+struct BinaryOperator {
+    ast::Binary::Operator op;
+    // The binding power, where 0 marks a token which doesn't continue an expression.
+    uint8_t power;
+};
+
+static constexpr auto BINARY_OPERATORS = [] {
+    std::array<BinaryOperator, static_cast<size_t>(Token::Type::Unknown) + 1> operators{};
+
+    const auto set = [&](Token::Type type, ast::Binary::Operator op, uint8_t power) {
+        operators[static_cast<size_t>(type)] = {op, power};
+    };
+
+    set(Token::Type::GreaterThan, ast::Binary::Operator::GreaterThan, 1);
+    set(Token::Type::LessThan, ast::Binary::Operator::LessThan, 1);
+    set(Token::Type::Plus, ast::Binary::Operator::Add, 2);
+    set(Token::Type::Minus, ast::Binary::Operator::Sub, 2);
+    set(Token::Type::Asterisk, ast::Binary::Operator::Mul, 3);
+    set(Token::Type::Slash, ast::Binary::Operator::Div, 3);
+
+    return operators;
+}();
+
 ast::Program Parser::parse_program() {
-    std::vector<std::unique_ptr<ast::Node>> statements;
-    auto own_scope = _enter_scope();
+    auto statements = parse_program_statements();
+
+    return ast::Program(_arena.make_span(std::move(statements)));
+}
+
+std::optional<ast::Program> Parser::parse_program(std::string_view data, ast::AstArena &arena,
+                                                  DiagnosticEngine &diagnostics, ThreadPool &pool) {
+    // A few chunks per thread balance out functions of different sizes, without paying for a task per function.
+    const auto chunk_size = data.size() / (pool.size() * CHUNKS_PER_THREAD);
+
+    auto parts = _parse_parts(data, chunk_size, diagnostics, &pool);
+    if (!parts) return std::nullopt;
+
+    std::vector<ast::Node *> statements;
+    for (auto &part: *parts) {
+        const auto &part_statements = part.program.statements();
+        statements.insert(statements.end(), part_statements.begin(), part_statements.end());
+
+        arena.absorb(std::move(*part.arena));
+    }
+
+    return ast::Program(arena.make_span(std::move(statements)));
+}
+
+std::optional<std::vector<Parser::Part>> Parser::parse_parts(std::string_view data, DiagnosticEngine &diagnostics) {
+    return _parse_parts(data, 0, diagnostics, nullptr);
+}
+
+std::optional<std::vector<Parser::Part>> Parser::parse_parts(std::string_view data, DiagnosticEngine &diagnostics,
+                                                             ThreadPool &pool) {
+    return _parse_parts(data, 0, diagnostics, &pool);
+}
+
+std::optional<std::vector<Parser::Part>> Parser::_parse_parts(std::string_view data, size_t chunk_size,
+                                                              DiagnosticEngine &diagnostics, ThreadPool *pool) {
+    struct ParsedChunk {
+        std::vector<ast::Node *> statements;
+        DiagnosticEngine diagnostics;
+        bool crossed;
+        bool failed;
+    };
+
+    const auto chunks = Scanner::split(data, chunk_size);
+
+    // Every chunk creates its nodes in an arena of its own, as the arenas are not synchronized.
+    std::vector<std::unique_ptr<ast::AstArena>> arenas;
+    arenas.reserve(chunks.size());
+    for (size_t index = 0; index < chunks.size(); index++) arenas.push_back(std::make_unique<ast::AstArena>());
+
+    const auto limit = diagnostics.limit();
+
+    // Parses the chunks from "first" to "last" as a single one, which ends in front of the "fun" of the next chunk.
+    const auto parse_chunks = [&chunks, data, limit](size_t first, size_t last, ast::AstArena &chunk_arena) {
+        const size_t begin = chunks[first].offset, end = chunks[last].offset + chunks[last].data.size();
+        const auto followed = (last + 1 < chunks.size());
+
+        // The engines are not synchronized either, thus every chunk reports to its own one.
+        DiagnosticEngine chunk_diagnostics(limit);
+
+        Scanner scanner(data.substr(begin, end - begin), chunk_diagnostics, chunks[first].offset, followed);
+        Parser parser(scanner, chunk_arena, chunk_diagnostics);
+
+        const auto boundary = (followed ? std::optional(static_cast<uint32_t>(end)) : std::nullopt);
+        auto statements = parser.parse_program_statements(boundary);
+        const auto failed = scanner.has_failed() || parser.has_failed();
+        return ParsedChunk{std::move(statements), std::move(chunk_diagnostics), parser.crossed_boundary(), failed};
+    };
+
+    // Without a thread pool the chunks are parsed lazily, right when their result is taken.
+    std::vector<std::future<ParsedChunk>> parsed;
+    parsed.reserve(chunks.size());
+    for (size_t index = 0; index < chunks.size(); index++) {
+        auto task = [&parse_chunks, &chunk_arena = *arenas[index], index] {
+            return parse_chunks(index, index, chunk_arena);
+        };
+
+        parsed.push_back(pool ? pool->submit(std::move(task)) : std::async(std::launch::deferred, std::move(task)));
+    }
+
+    // The tasks reference the chunks and arenas, thus all of them must be done before an exception may unwind.
+    if (pool) {
+        for (const auto &future: parsed) future.wait();
+    }
+
+    std::vector<Part> parts;
+    bool failed = false;
+    for (size_t index = 0; index < chunks.size(); index++) {
+        auto chunk = parsed[index].get();
+        auto chunk_arena = std::move(arenas[index]);
+
+        // The recovery from an error may swallow the "fun" of the next chunk, thus the serial parser skips that
+        // function. To report the same, the chunk is parsed again together with the next one.
+        const auto first = index;
+        while (chunk.crossed) {
+            if (pool) std::ignore = parsed[++index].get();
+            else index++;
+
+            chunk_arena = std::make_unique<ast::AstArena>();
+            chunk = parse_chunks(first, index, *chunk_arena);
+        }
+
+        diagnostics.absorb(std::move(chunk.diagnostics));
+        failed |= chunk.failed;
+
+        auto program = ast::Program(chunk_arena->make_span(std::move(chunk.statements)));
+        parts.push_back({program, std::move(chunk_arena)});
+    }
+
+    if (failed) return std::nullopt;
+
+    return parts;
+}
+
+std::vector<ast::Node *> Parser::parse_program_statements(std::optional<uint32_t> boundary) {
+    std::vector<ast::Node *> statements;
+
+    // Unless the statements end right in front of the boundary, the parser went past it.
+    _crossed_boundary = boundary.has_value();
 
     while (true) {
         const auto &current = _current();
@@ -16,35 +159,44 @@ ast::Program Parser::parse_program() {
             continue;
         }
 
-        if (current.type() == Token::Type::EndOfFile) {
+        if (current.type() == Token::Type::EndOfFile) break;
+
+        if (boundary && current.type() == Token::Type::Fun && current.offset() == *boundary) {
+            _crossed_boundary = false;
             break;
         }
 
-        try {
-            statements.push_back(_parse_program_statement());
-        } catch (const UnexpectedToken &error) {
-            std::cout << error.what() << std::endl;
+        auto *statement = _parse_program_statement();
+        if (_error == Error::UnexpectedToken) {
+            _error = Error::None;
             _recover_program();
-            _failed = true;
-        } catch (const UnexpectedEndOfTokens &error) {
-            std::cout << error.what() << std::endl;
-            _failed = true;
+            continue;
+        }
+
+        if (_error != Error::None) {
+            _error = Error::None;
             break;
         }
+
+        statements.push_back(statement);
     }
 
-    _exit_scope();
+    // Once the limit of diagnostics is reached, the serial parser doesn't get any further either.
+    if (_diagnostics.is_full()) _crossed_boundary = false;
 
-    return {std::move(statements), own_scope};
+    return statements;
 }
 
-std::unique_ptr<ast::Node> Parser::_parse_program_statement() {
+ast::Node *Parser::_parse_program_statement() {
     const auto &current = _consume_any();
+    if (_is_failing()) return nullptr;
+
     if (current.type() == Token::Type::Fun) {
         return _parse_function(current);
     }
 
-    throw UnexpectedToken("fun", current);
+    _unexpected("fun", current);
+    return nullptr;
 }
 
 void Parser::_recover_program() {
@@ -58,52 +210,68 @@ void Parser::_recover_program() {
     }
 }
 
-std::unique_ptr<ast::Function> Parser::_parse_function(const Token &) {
-    auto own_scope = _enter_scope();
+ast::Function *Parser::_parse_function(const Token &) {
+    _locals = 0;
 
     const auto &name = _consume(Token::Type::Identifier);
+    if (_is_failing()) return nullptr;
+
     auto identifier = ast::Identifier(name, ast::Identifier::Kind::Function);
 
     auto parameters = _parse_parameters();
+    if (_is_failing()) return nullptr;
 
     auto return_type = _parse_type();
+    if (_is_failing()) return nullptr;
 
     _consume(Token::Type::Colon);
+    if (_is_failing()) return nullptr;
 
     _consume(Token::Type::Newline);
+    if (_is_failing()) return nullptr;
 
     auto block = _parse_block();
+    if (_is_failing()) return nullptr;
 
-    _exit_scope();
-
-    return std::make_unique<ast::Function>(identifier, std::move(parameters), return_type, std::move(block), own_scope);
+    return _arena.make<ast::Function>(identifier, _arena.make_span(std::move(parameters)), *return_type, block,
+                                      _locals);
 }
 
 std::vector<ast::Parameter> Parser::_parse_parameters() {
     std::vector<ast::Parameter> parameters;
 
     _consume(Token::Type::LParent);
+    if (_is_failing()) return parameters;
 
     while (true) {
         const auto &current = _current();
-        if (current.type() == Token::Type::EndOfFile) throw UnexpectedEndOfTokens();
+        if (current.type() == Token::Type::EndOfFile) {
+            _end_of_tokens();
+            return parameters;
+        }
+
         if (current.type() == Token::Type::RParent) break;
 
         if (!parameters.empty()) {
             _consume(Token::Type::Comma);
+            if (_is_failing()) return parameters;
         }
 
-        try {
-            parameters.push_back(_parse_parameter());
-        } catch (const UnexpectedToken &error) {
-            std::cout << error.what() << std::endl;
+        auto parameter = _parse_parameter();
+        if (_error == Error::UnexpectedToken) {
+            _error = Error::None;
             _recover_parameters();
-            _failed = true;
-        } catch (const UnexpectedEndOfTokens &error) {
-            std::cout << error.what() << std::endl;
-            _failed = true;
+            continue;
+        }
+
+        if (_error == Error::EndOfTokens) {
+            _error = Error::None;
             break;
         }
+
+        if (_is_failing()) return parameters;
+
+        parameters.push_back(*parameter);
     }
 
     _consume(Token::Type::RParent);
@@ -123,71 +291,90 @@ void Parser::_recover_parameters() {
     }
 }
 
-ast::Parameter Parser::_parse_parameter() {
+std::optional<ast::Parameter> Parser::_parse_parameter() {
     const auto &name = _consume(Token::Type::Identifier);
+    if (_is_failing()) return std::nullopt;
+
     auto identifier = ast::Identifier(name, ast::Identifier::Kind::Variable);
 
     auto type = _parse_type();
+    if (_is_failing()) return std::nullopt;
 
-    return {identifier, type};
+    return ast::Parameter(identifier, *type);
 }
 
-sem::Type Parser::_parse_type() {
+std::optional<sem::Type> Parser::_parse_type() {
     _consume(Token::Type::At);
+    if (_is_failing()) return std::nullopt;
 
     auto token = _consume_any();
+    if (_is_failing()) return std::nullopt;
+
     switch (token.type()) {
-        case Token::Type::U8: return sem::Integral(Size::BYTE, false);
-        case Token::Type::S8: return sem::Integral(Size::BYTE, true);
-        case Token::Type::U16: return sem::Integral(Size::WORD, false);
-        case Token::Type::S16: return sem::Integral(Size::WORD, true);
-        case Token::Type::U32: return sem::Integral(Size::DWORD, false);
-        case Token::Type::S32: return sem::Integral(Size::DWORD, true);
-        case Token::Type::U64: return sem::Integral(Size::QWORD, false);
-        case Token::Type::S64: return sem::Integral(Size::QWORD, true);
-        case Token::Type::USize: return sem::Integral(Size::QWORD, false);
-        case Token::Type::SSize: return sem::Integral(Size::QWORD, true);
-        case Token::Type::F32: return sem::Floating(Size::DWORD);
-        case Token::Type::F64: return sem::Floating(Size::QWORD);
-        case Token::Type::Bool: return sem::Boolean();
-        default: throw UnexpectedToken("u8, s8, u16, s16, u32, s32, u64, s64, usize, ssize, bool", token);
+        case Token::Type::U8: return sem::TypeId::U8;
+        case Token::Type::S8: return sem::TypeId::S8;
+        case Token::Type::U16: return sem::TypeId::U16;
+        case Token::Type::S16: return sem::TypeId::S16;
+        case Token::Type::U32: return sem::TypeId::U32;
+        case Token::Type::S32: return sem::TypeId::S32;
+        case Token::Type::U64: return sem::TypeId::U64;
+        case Token::Type::S64: return sem::TypeId::S64;
+        case Token::Type::USize: return sem::TypeId::U64;
+        case Token::Type::SSize: return sem::TypeId::S64;
+        case Token::Type::F32: return sem::TypeId::F32;
+        case Token::Type::F64: return sem::TypeId::F64;
+        case Token::Type::Bool: return sem::TypeId::Bool;
+        default: {
+            _unexpected("u8, s8, u16, s16, u32, s32, u64, s64, usize, ssize, bool", token);
+            return std::nullopt;
+        }
     }
 }
 
-std::unique_ptr<ast::Block> Parser::_parse_block() {
-    std::vector<std::unique_ptr<ast::Node>> statements;
+ast::Block *Parser::_parse_block() {
+    std::vector<ast::Node *> statements;
 
-    auto own_scope = _enter_scope();
     _consume(Token::Type::Indentation);
+    if (_is_failing()) return nullptr;
 
     while (true) {
         const auto &current = _current();
-        if (current.type() == Token::Type::EndOfFile) throw UnexpectedEndOfTokens();
+        if (current.type() == Token::Type::EndOfFile) {
+            _end_of_tokens();
+            return nullptr;
+        }
+
         if (current.type() == Token::Type::Dedentation) break;
 
-        try {
-            statements.push_back(_parse_block_statement());
-        } catch (const UnexpectedToken &error) {
-            std::cout << error.what() << std::endl;
+        auto *statement = _parse_block_statement();
+        if (_error == Error::UnexpectedToken) {
+            _error = Error::None;
             _recover_block();
-            _failed = true;
-        } catch (const UnexpectedEndOfTokens &) {
-            throw;
+            continue;
         }
+
+        // Reaching the end of the tokens can't be recovered from within a block.
+        if (_is_failing()) return nullptr;
+
+        statements.push_back(statement);
     }
 
     _consume(Token::Type::Dedentation);
-    _exit_scope();
+    if (_is_failing()) return nullptr;
 
-    return std::make_unique<ast::Block>(std::move(statements), own_scope);
+    return _arena.make<ast::Block>(_arena.make_span(std::move(statements)));
 }
 
-std::unique_ptr<ast::Node> Parser::_parse_block_statement() {
-    std::unique_ptr<ast::Node> result;
+ast::Node *Parser::_parse_block_statement() {
+    ast::Node *result{};
 
     const auto &consumed = _consume_any();
+    if (_is_failing()) return nullptr;
+
     if (consumed.type() == Token::Type::Return) {
         result = _parse_return(consumed);
+        if (_is_failing()) return nullptr;
+
         _consume(Token::Type::Newline);
     } else if (consumed.type() == Token::Type::Identifier) {
         auto &current = _current();
@@ -198,14 +385,18 @@ std::unique_ptr<ast::Node> Parser::_parse_block_statement() {
         } else if (current.type() == Token::Type::At) {
             result = _parse_variable(consumed);
         }
+        if (_is_failing()) return nullptr;
+
         _consume(Token::Type::Newline);
     } else if (consumed.type() == Token::Type::If) {
         result = _parse_if(consumed);
         // Don't need to consume a newline, as the then node already parsed it
     } else {
-        throw UnexpectedToken("return, if, assign or call", consumed);
+        _unexpected("return, if, assign or call", consumed);
     }
 
+    if (_is_failing()) return nullptr;
+
     return result;
 }
 
@@ -221,247 +412,235 @@ void Parser::_recover_block() {
     }
 }
 
-std::unique_ptr<ast::Return> Parser::_parse_return(const Token &) {
+ast::Return *Parser::_parse_return(const Token &) {
     auto expression = _parse_expression();
+    if (_is_failing()) return nullptr;
 
-    return std::make_unique<ast::Return>(std::move(expression));
+    return _arena.make<ast::Return>(expression);
 }
 
-std::unique_ptr<ast::If> Parser::_parse_if(const Token &) {
+ast::If *Parser::_parse_if(const Token &) {
     auto expression = _parse_expression();
+    if (_is_failing()) return nullptr;
 
     _consume(Token::Type::Colon);
+    if (_is_failing()) return nullptr;
 
-    std::unique_ptr<ast::Node> branch;
+    ast::Node *branch{};
     if (_try_consume(Token::Type::Newline)) {
         branch = _parse_block();
     } else {
         branch = _parse_block_statement();
     }
+    if (_is_failing()) return nullptr;
 
     if (!_try_consume(Token::Type::Else)) {
-        return std::make_unique<ast::If>(std::move(expression), std::move(branch), nullptr);
+        return _arena.make<ast::If>(expression, branch, nullptr);
     }
 
     if (const auto token = _try_consume(Token::Type::If)) {
-        return std::make_unique<ast::If>(std::move(expression), std::move(branch), _parse_if(*token));
+        auto *next = _parse_if(*token);
+        if (_is_failing()) return nullptr;
+
+        return _arena.make<ast::If>(expression, branch, next);
     }
 
     _consume(Token::Type::Colon);
+    if (_is_failing()) return nullptr;
 
-    std::unique_ptr<ast::Node> _next;
+    ast::Node *_next{};
     if (_try_consume(Token::Type::Newline)) {
         _next = _parse_block();
     } else {
         _next = _parse_block_statement();
     }
+    if (_is_failing()) return nullptr;
 
-    return std::make_unique<ast::If>(std::move(expression), std::move(branch), std::move(_next));
+    return _arena.make<ast::If>(expression, branch, _next);
 }
 
-std::unique_ptr<ast::Assign> Parser::_parse_assign(const Token &name) {
+ast::Assign *Parser::_parse_assign(const Token &name) {
     auto identifier = ast::Identifier(name, ast::Identifier::Kind::Variable);
 
     _consume(Token::Type::Equal);
+    if (_is_failing()) return nullptr;
 
     auto expression = _parse_expression();
+    if (_is_failing()) return nullptr;
 
-    return std::make_unique<ast::Assign>(identifier, std::move(expression));
+    return _arena.make<ast::Assign>(identifier, expression);
 }
 
-std::unique_ptr<ast::Variable> Parser::_parse_variable(const Token &name) {
+ast::Variable *Parser::_parse_variable(const Token &name) {
     auto identifier = ast::Identifier(name, ast::Identifier::Kind::Variable);
 
     auto type = _parse_type();
+    if (_is_failing()) return nullptr;
 
     _consume(Token::Type::Equal);
+    if (_is_failing()) return nullptr;
 
     auto expression = _parse_expression();
+    if (_is_failing()) return nullptr;
+
+    _locals++;
 
-    return std::make_unique<ast::Variable>(identifier, type, std::move(expression));
+    return _arena.make<ast::Variable>(identifier, *type, expression);
 }
 
-std::unique_ptr<ast::Call> Parser::_parse_call(const Token &name) {
+ast::Call *Parser::_parse_call(const Token &name) {
     auto identifier = ast::Identifier(name, ast::Identifier::Kind::Function);
 
     _consume(Token::Type::LParent);
+    if (_is_failing()) return nullptr;
 
-    std::vector<std::unique_ptr<ast::Node>> arguments;
+    std::vector<ast::Node *> arguments;
     while (true) {
         const auto &current = _current();
-        if (current.type() == Token::Type::EndOfFile) throw UnexpectedEndOfTokens();
+        if (current.type() == Token::Type::EndOfFile) {
+            _end_of_tokens();
+            return nullptr;
+        }
+
         if (current.type() == Token::Type::RParent) break;
 
         if (!arguments.empty()) {
             _consume(Token::Type::Comma);
+            if (_is_failing()) return nullptr;
         }
 
-        arguments.push_back(_parse_expression());
+        auto *argument = _parse_expression();
+        if (_is_failing()) return nullptr;
+
+        arguments.push_back(argument);
     }
 
     _consume(Token::Type::RParent);
+    if (_is_failing()) return nullptr;
 
-    return std::make_unique<ast::Call>(identifier, std::move(arguments));
+    return _arena.make<ast::Call>(identifier, _arena.make_span(std::move(arguments)));
 }
 
-std::unique_ptr<ast::Node> Parser::_parse_expression() {
-    return _parse_comparison();
-}
-
-std::unique_ptr<ast::Node> Parser::_parse_comparison() {
-    auto expression = _parse_term();
-
-    while (auto op = _try_consume(_is_comparison_operator)) {
-        auto type = _to_binary_operator(op.value());
-
-        expression = std::make_unique<ast::Binary>(std::move(expression), type, _parse_term());
-    }
-
-    return expression;
-}
+ast::Node *Parser::_parse_expression(uint8_t min_power) {
+    auto *expression = _parse_primary();
+    if (_is_failing()) return nullptr;
 
-std::unique_ptr<ast::Node> Parser::_parse_term() {
-    auto expression = _parse_factor();
-
-    while (auto op = _try_consume(_is_term_operator)) {
-        auto type = _to_binary_operator(op.value());
-
-        expression = std::make_unique<ast::Binary>(std::move(expression), type, _parse_factor());
-    }
-
-    return expression;
-}
+    while (true) {
+        const auto [op, power] = BINARY_OPERATORS[static_cast<size_t>(_current().type())];
 
-std::unique_ptr<ast::Node> Parser::_parse_factor() {
-    auto expression = _parse_primary();
+        // Every operator is left-associative, thus an operator of the same power ends the right operand.
+        if (power <= min_power) break;
+        _next();
 
-    while (auto op = _try_consume(_is_factor_operator)) {
-        auto type = _to_binary_operator(op.value());
+        auto right = _parse_expression(power);
+        if (_is_failing()) return nullptr;
 
-        expression = std::make_unique<ast::Binary>(std::move(expression), type, _parse_primary());
+        expression = _arena.make<ast::Binary>(expression, op, right);
     }
 
     return expression;
 }
 
-std::unique_ptr<ast::Node> Parser::_parse_primary() {
+ast::Node *Parser::_parse_primary() {
     const auto &consumed = _consume_any();
+    if (_is_failing()) return nullptr;
+
     if (consumed.type() == Token::Type::Integer) {
-        auto node = std::make_unique<ast::Immediate>(consumed, ast::Immediate::Kind::Integer);
+        auto node = _arena.make<ast::Immediate>(consumed, ast::Immediate::Kind::Integer);
         if (_current().type() != Token::Type::At) return node;
 
-        return std::make_unique<ast::Cast>(std::move(node), _parse_type());
+        const auto type = _parse_type();
+        if (_is_failing()) return nullptr;
+
+        return _arena.make<ast::Cast>(node, *type);
     }
 
     if (consumed.type() == Token::Type::Floating) {
-        auto node = std::make_unique<ast::Immediate>(consumed, ast::Immediate::Kind::Floating);
+        auto node = _arena.make<ast::Immediate>(consumed, ast::Immediate::Kind::Floating);
         if (_current().type() != Token::Type::At) return node;
 
-        return std::make_unique<ast::Cast>(std::move(node), _parse_type());
+        const auto type = _parse_type();
+        if (_is_failing()) return nullptr;
+
+        return _arena.make<ast::Cast>(node, *type);
     }
 
     if (consumed.type() == Token::Type::Identifier) {
         if (_current().type() == Token::Type::LParent) return _parse_call(consumed);
 
-        return std::make_unique<ast::Identifier>(consumed, ast::Identifier::Kind::Variable);
+        return _arena.make<ast::Identifier>(consumed, ast::Identifier::Kind::Variable);
     }
 
     if (consumed.type() == Token::Type::True || consumed.type() == Token::Type::False) {
-        return std::make_unique<ast::Immediate>(consumed, ast::Immediate::Kind::Boolean);
+        return _arena.make<ast::Immediate>(consumed, ast::Immediate::Kind::Boolean);
     }
 
     if (consumed.type() == Token::Type::LParent) {
         auto expression = _parse_expression();
-        _consume(Token::Type::RParent);
-        return expression;
-    }
-
-    throw UnexpectedToken("integer, float, identifier, function call, grouping, true or false", consumed);
-}
+        if (_is_failing()) return nullptr;
 
-std::shared_ptr<sem::SymbolTable> Parser::_current_scope() {
-    return _scopes.top();
-}
+        _consume(Token::Type::RParent);
+        if (_is_failing()) return nullptr;
 
-std::shared_ptr<sem::SymbolTable> Parser::_enter_scope() {
-    if (_scopes.empty()) {
-        return _scopes.emplace(std::make_shared<sem::SymbolTable>());
+        return expression;
     }
 
-    auto parent = _current_scope();
-    return _scopes.emplace(std::make_shared<sem::SymbolTable>(parent));
-}
-
-void Parser::_exit_scope() {
-    _scopes.pop();
+    _unexpected("integer, float, identifier, function call, grouping, true or false", consumed);
+    return nullptr;
 }
 
 const Token &Parser::_current() {
-    return _tokens[_position];
+    return _tokens.peek();
 }
 
 void Parser::_next() {
-    if (_position >= _tokens.size()) throw UnexpectedEndOfTokens();
-    _position++;
+    if (_reached_end) return _end_of_tokens();
+    if (_tokens.next().type() == Token::Type::EndOfFile) _reached_end = true;
 }
 
-const Token &Parser::_consume_any() {
-    const auto &current = _current();
+Token Parser::_consume_any() {
+    auto current = _current();
     _next();
     return current;
 }
 
-const Token &Parser::_consume(Token::Type type) {
-    const auto &current = _current();
+Token Parser::_consume(Token::Type type) {
+    auto current = _current();
     _next();
 
-    if (current.type() != type) throw UnexpectedToken(to_string(type), current);
-
-    return current;
-}
-
-std::optional<Token> Parser::_try_consume(const std::function<bool(const Token &)> &predicate) {
-    const auto &current = _current();
-
-    if (!predicate(current)) return std::nullopt;
-
-    _next();
+    if (!_is_failing() && current.type() != type) _unexpected(to_string(type), current);
 
     return current;
 }
 
 std::optional<Token> Parser::_try_consume(Token::Type type) {
-    const auto &current = _current();
-
-    if (current.type() != type) return std::nullopt;
-
-    _next();
+    if (_current().type() != type) return std::nullopt;
 
-    return current;
+    return _consume_any();
 }
 
-ast::Binary::Operator Parser::_to_binary_operator(const Token &token) {
-    switch (token.type()) {
-        case Token::Type::Slash: return ast::Binary::Operator::Div;
-        case Token::Type::Asterisk: return ast::Binary::Operator::Mul;
-        case Token::Type::Plus: return ast::Binary::Operator::Add;
-        case Token::Type::Minus: return ast::Binary::Operator::Sub;
-        case Token::Type::GreaterThan: return ast::Binary::Operator::GreaterThan;
-        case Token::Type::LessThan: return ast::Binary::Operator::LessThan;
-        default: std::unreachable();
-    }
+void Parser::_unexpected(const std::string &expected, const Token &got) {
+    const Span span{got.offset(), static_cast<uint32_t>(got.contents().size())};
+    _report({Diagnostic::Code::UnexpectedToken, span, {expected, to_string(got.type())}});
 }
 
-bool Parser::_is_factor_operator(const Token &token) {
-    return token.type() == Token::Type::Asterisk || token.type() == Token::Type::Slash;
+void Parser::_end_of_tokens() {
+    _report({Diagnostic::Code::UnexpectedEndOfTokens, std::nullopt});
 }
 
-bool Parser::_is_comparison_operator(const Token &token) {
-    return token.type() == Token::Type::GreaterThan || token.type() == Token::Type::LessThan;
-}
+void Parser::_report(Diagnostic diagnostic) {
+    const auto code = diagnostic.code();
 
-bool Parser::_is_term_operator(const Token &token) {
-    return token.type() == Token::Type::Plus || token.type() == Token::Type::Minus;
+    _diagnostics.report(std::move(diagnostic));
+    _failed = true;
+
+    if (_diagnostics.is_full()) {
+        _error = Error::Aborted;
+    } else if (code == Diagnostic::Code::UnexpectedToken) {
+        _error = Error::UnexpectedToken;
+    } else {
+        _error = Error::EndOfTokens;
+    }
 }
 
 //==============================================================================
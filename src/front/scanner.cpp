@@ -1,85 +1,261 @@
 #include "front/scanner.hpp"
 
-#include <sstream>
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <tuple>
+
+#include "front/simd.hpp"
 
 using namespace arkoi::front;
 using namespace arkoi;
 
 static constexpr size_t SPACE_INDENTATION = 4;
 
+static constexpr auto CHAR_CLASSES = [] {
+    std::array<uint8_t, 256> classes{};
+
+    for (size_t index = 0; index < classes.size(); index++) {
+        const auto input = static_cast<char>(index);
+        auto &current = classes[index];
+
+        const auto lower = (input >= 'a' && input <= 'z');
+        const auto upper = (input >= 'A' && input <= 'Z');
+        const auto digit = (input >= '0' && input <= '9');
+
+        if (input == ' ' || (input >= '\t' && input <= '\r')) current |= Scanner::Space;
+        if (digit) current |= Scanner::Digit;
+        if (lower || upper || input == '_') current |= Scanner::IdentStart;
+        if (digit || (input >= 'a' && input <= 'f') || (input >= 'A' && input <= 'F')) current |= Scanner::Hex;
+        if (input == 'p' || input == 'P') current |= Scanner::HexExpo;
+        if (input == 'e' || input == 'E') current |= Scanner::Expo;
+        if (input == '+' || input == '-') current |= Scanner::DecimalSign;
+        if (index <= 127) current |= Scanner::Ascii;
+    }
+
+    return classes;
+}();
+
+struct CharValue {
+    std::array<char, 3> digits;
+    size_t size;
+};
+
+// Character literals are represented by their decimal value. As those digits don't exist in the source buffer, the
+// tokens point into this table instead.
+static constexpr auto CHAR_VALUES = [] {
+    std::array<CharValue, 128> values{};
+
+    for (size_t value = 0; value < values.size(); value++) {
+        auto &[digits, size] = values[value];
+        if (value >= 100) digits[size++] = static_cast<char>('0' + value / 100);
+        if (value >= 10) digits[size++] = static_cast<char>('0' + value / 10 % 10);
+        digits[size++] = static_cast<char>('0' + value % 10);
+    }
+
+    return values;
+}();
+
+// Decodes the literal exactly once, thus the later phases never have to parse it again. Just like the scanner, the
+// decoding doesn't depend on the locale.
+static std::optional<Token::Number> decode_number(std::string_view number, bool floating) {
+    auto digits = number;
+
+    const auto negative = digits.starts_with('-');
+    if (negative) digits.remove_prefix(1);
+
+    const auto hex = digits.starts_with("0x");
+    if (hex) digits.remove_prefix(2);
+
+    const auto *begin = digits.data(), *end = digits.data() + digits.size();
+
+    if (floating) {
+        double value;
+        const auto format = (hex ? std::chars_format::hex : std::chars_format::general);
+        const auto error = std::from_chars(begin, end, value, format).ec;
+        if (error == std::errc::result_out_of_range) {
+            // Underflows are reported as out of range as well, but only a magnitude beyond the limit overflowed.
+            const auto magnitude = std::strtod(std::string(number.substr(negative)).c_str(), nullptr);
+            if (magnitude == HUGE_VAL) return std::nullopt;
+
+            value = 0.0;
+        } else if (error != std::errc()) {
+            return std::nullopt;
+        }
+
+        return (negative ? -value : value);
+    }
+
+    uint64_t magnitude;
+    if (std::from_chars(begin, end, magnitude, (hex ? 16 : 10)).ec != std::errc()) return std::nullopt;
+
+    const auto limit = static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) + negative;
+    if (magnitude > limit) return std::nullopt;
+
+    return static_cast<int64_t>(negative ? 0 - magnitude : magnitude);
+}
+
 std::vector<Token> Scanner::tokenize() {
     std::vector<Token> tokens;
 
-    std::istringstream stream(_data);
-    std::string line;
+    while (true) {
+        const auto &token = tokens.emplace_back(next_token());
+        if (token.type() == Token::Type::EndOfFile) break;
+    }
+
+    return tokens;
+}
+
+bool Scanner::is_function_start(std::string_view line) {
+    static constexpr std::string_view FUN = "fun";
 
-    while (std::getline(stream, line)) {
-        if (line.empty()) continue;
-        _current_line = line;
+    if (!line.starts_with(FUN)) return false;
+    if (line.size() == FUN.size()) return true;
 
-        const auto leading_spaces = _leading_spaces(line);
-        if (leading_spaces % SPACE_INDENTATION != 0) {
-            std::cerr << "Leading spaces are not of a multiple of 4" << std::endl;
-            _failed = true;
+    const auto next = line[FUN.size()];
+    return !_is(next, IdentStart) && !_is(next, Digit);
+}
+
+std::vector<Scanner::Chunk> Scanner::split(std::string_view data, size_t chunk_size) {
+    std::vector<Chunk> chunks;
+
+    const auto *end = data.data() + data.size();
+    size_t line = 0, start = 0;
+    while (line < data.size()) {
+        if (data[line] == '\n') {
+            line++;
             continue;
         }
 
-        while (leading_spaces > _indentation) {
-            tokens.emplace_back(Token::Type::Indentation, _column, _row, "");
-            _indentation += SPACE_INDENTATION;
-            _column += SPACE_INDENTATION;
-        }
+        const auto *begin = data.data() + line;
+        const auto leading = static_cast<size_t>(simd::skip_spaces(begin, end) - begin);
 
-        while (leading_spaces < _indentation) {
-            tokens.emplace_back(Token::Type::Dedentation, _column, _row, "");
-            _indentation -= SPACE_INDENTATION;
-            _column -= SPACE_INDENTATION;
+        const auto is_function = (leading == 0 && is_function_start(data.substr(line)));
+        if (is_function && line > start && line - start >= chunk_size) {
+            chunks.push_back({data.substr(start, line - start), static_cast<uint32_t>(start)});
+            start = line;
         }
 
-        while (!_is_eol()) {
-            try {
-                auto token = _next_token();
-                tokens.push_back(token);
-            } catch (const UnexpectedEndOfLine &error) {
-                std::cerr << error.what() << std::endl;
-                _failed = true;
-                break;
-            } catch (const UnexpectedChar &error) {
-                std::cerr << error.what() << std::endl;
-                _failed = true;
-                _next();
-            } catch (const UnknownChar &error) {
-                std::cerr << error.what() << std::endl;
-                _failed = true;
-                _next();
-            }
-        }
+        const auto *newline = simd::find_newline(begin + leading, end);
+        line = (newline == end ? data.size() : newline - data.data() + 1);
+    }
 
-        tokens.emplace_back(Token::Type::Newline, _column, _row, "");
+    chunks.push_back({data.substr(start), static_cast<uint32_t>(start)});
+    return chunks;
+}
 
-        _column = _indentation;
-        _row++;
-    }
+// The buffer is walked in a single pass: "_line" is the offset of the current line and "_column" the offset into it,
+// thus no line is ever copied out of the source. Every call resumes from "_state" and returns exactly one token.
+Token Scanner::next_token() {
+    while (true) {
+        // Once the limit of diagnostics is reached, the rest of the source isn't scanned anymore.
+        if (_diagnostics.is_full()) _state = State::EndOfFile;
+
+        switch (_state) {
+            case State::LineStart: {
+                if (_line >= _data.size()) {
+                    _state = State::EndOfFile;
+                    continue;
+                }
+
+                if (_data[_line] == '\n') {
+                    _line++;
+                    continue;
+                }
+
+                _leading = _leading_spaces();
+                if (_leading % SPACE_INDENTATION != 0) {
+                    _report(Diagnostic::Code::Misindentation, {_position(0), static_cast<uint32_t>(_leading)});
+                    _skip_line(_leading);
+                    continue;
+                }
+
+                _state = State::Indentation;
+                continue;
+            }
+            case State::Indentation: {
+                if (_leading > _indentation) {
+                    Token token(Token::Type::Indentation, _position(_column), "");
+                    _indentation += SPACE_INDENTATION;
+                    _column += SPACE_INDENTATION;
+                    return token;
+                }
+
+                if (_leading < _indentation) {
+                    // The dedentations sit in front of the first token of the line, not at the old indentation.
+                    Token token(Token::Type::Dedentation, _position(_leading), "");
+                    _indentation -= SPACE_INDENTATION;
+                    _column -= SPACE_INDENTATION;
+                    return token;
+                }
+
+                _state = State::Line;
+                continue;
+            }
+            case State::Line: {
+                if (_is_eol()) {
+                    _state = State::LineEnd;
+                    continue;
+                }
+
+                if (auto token = _lex_token()) return *token;
+
+                if (_error == Diagnostic::Code::UnexpectedEndOfLine) {
+                    _state = State::LineEnd;
+                } else if (_error == Diagnostic::Code::UnexpectedChar) {
+                    _next();
+                } else {
+                    // Trailing whitespace leaves nothing to lex, in which case the line is already over.
+                    if (_is_eol()) _state = State::LineEnd;
+                    _next();
+                }
+
+                continue;
+            }
+            case State::LineEnd: {
+                Token token(Token::Type::Newline, _position(_column), "");
 
-    while (_indentation) {
-        tokens.emplace_back(Token::Type::Dedentation, _column, _row, "");
-        _indentation -= SPACE_INDENTATION;
-    }
+                // Trailing whitespace moves the column past the newline, thus the line end is searched again.
+                _skip_line(_leading);
+                _column = _indentation;
 
-    tokens.emplace_back(Token::Type::EndOfFile, 0, 0, "");
+                _state = State::LineStart;
+                return token;
+            }
+            case State::EndOfFile: {
+                if (_indentation) {
+                    const auto end = static_cast<uint32_t>(_offset + _data.size());
+                    Token token(Token::Type::Dedentation, std::min(_position(_column), end), "");
+                    _indentation -= SPACE_INDENTATION;
+                    return token;
+                }
+
+                if (_followed) {
+                    _followed = false;
+                    return {Token::Type::Fun, static_cast<uint32_t>(_offset + _data.size()), "fun"};
+                }
+
+                return {Token::Type::EndOfFile, static_cast<uint32_t>(_offset + _data.size()), ""};
+            }
+        }
 
-    return tokens;
+        // As the -Wswitch flag is set, this will never be reached.
+        std::unreachable();
+    }
 }
 
-Token Scanner::_next_token() {
-    while (_try_consume(_is_space)) {}
+std::optional<Token> Scanner::_lex_token() {
+    while (_try_consume(Space)) {}
 
     const auto current = _current_char();
-    if (_is_ident_start(current)) {
+    if (_is(current, IdentStart)) {
         return _lex_identifier();
     }
 
-    if (current == '-' || _is_digit(current)) {
+    if (current == '-' || _is(current, Digit)) {
         return _lex_number();
     }
 
@@ -94,130 +270,134 @@ Token Scanner::_next_token() {
     return _lex_special();
 }
 
-Token Scanner::_lex_comment() {
-    auto[column, row] = _mark_start();
+std::optional<Token> Scanner::_lex_comment() {
+    const auto start = _mark_start();
 
-    _consume('#');
-    while (_try_consume(_is_not_newline)) {
-    }
+    if (!_consume('#')) return std::nullopt;
+    _column += simd::find_newline(_cursor(), _end()) - _cursor();
 
-    return {Token::Type::Comment, column, row, _current_view()};
+    return Token(Token::Type::Comment, start, _current_view());
 }
 
-Token Scanner::_lex_identifier() {
-    auto[column, row] = _mark_start();
+std::optional<Token> Scanner::_lex_identifier() {
+    const auto start = _mark_start();
 
-    _consume(_is_ident_start, "_, a-z or A-Z");
-    while (_try_consume(_is_ident_inner)) {
-    }
+    if (!_consume(IdentStart, "_, a-z or A-Z")) return std::nullopt;
+    _column += simd::skip_identifier(_cursor(), _end()) - _cursor();
 
     auto value = _current_view();
     if (auto keyword = Token::lookup_keyword(value)) {
-        return {*keyword, column, row, value};
+        return Token(*keyword, start, value);
     }
 
-    return {Token::Type::Identifier, column, row, value};
+    return Token(Token::Type::Identifier, start, value, Name(value));
 }
 
-Token Scanner::_lex_number() {
-    auto[column, row] = _mark_start();
+std::optional<Token> Scanner::_lex_number() {
+    const auto start = _mark_start();
 
-    if (_try_consume('-') && !_is_digit(_peek())) {
-        return {Token::Type::Minus, column, row, _current_view()};
+    if (_try_consume('-') && !_is(_peek(), Digit)) {
+        return Token(Token::Type::Minus, start, _current_view());
     }
 
-    const auto consumed = _consume(_is_digit, "0-9");
-    bool floating;
+    const auto consumed = _consume(Digit, "0-9");
+    if (!consumed) return std::nullopt;
 
+    bool floating;
     if (consumed == '0' && _try_consume('x')) {
-        _consume(_is_hex, "0-9, a-f or A-F");
+        if (!_consume(Hex, "0-9, a-f or A-F")) return std::nullopt;
 
-        while (_try_consume(_is_hex)) {
+        while (_try_consume(Hex)) {
         }
 
         floating = _try_consume('.');
 
-        while (_try_consume(_is_hex)) {
+        while (_try_consume(Hex)) {
         }
 
-        if (_try_consume(_is_hex_expo)) {
-            std::ignore = _try_consume(_is_decimal_sign);
+        if (_try_consume(HexExpo)) {
+            floating = true;
+
+            std::ignore = _try_consume(DecimalSign);
 
-            while (_try_consume(_is_hex));
+            while (_try_consume(Hex));
         }
     } else {
-        while (_try_consume(_is_digit)) {
+        while (_try_consume(Digit)) {
         }
 
         floating = _try_consume('.');
 
-        while (_try_consume(_is_digit)) {
+        while (_try_consume(Digit)) {
         }
 
-        if (_try_consume(_is_expo)) {
+        if (_try_consume(Expo)) {
             floating = true;
 
-            std::ignore = _try_consume(_is_decimal_sign);
-
-            while (_try_consume(_is_hex));
-        }
-    }
+            std::ignore = _try_consume(DecimalSign);
 
-    auto number = _current_view();
-    try {
-        if (floating) {
-            std::stold(number);
-        } else if (number.starts_with("-")) {
-            std::stoll(number);
-        } else {
-            std::stoull(number);
+            while (_try_consume(Hex));
         }
-    } catch (const std::out_of_range &) {
-        throw NumberOutOfRange(number);
     }
 
+    const auto number = _current_view();
     auto kind = (floating ? Token::Type::Floating : Token::Type::Integer);
 
-    return {kind, column, row, number};
+    const auto value = decode_number(number, floating);
+    if (!value) _report(Diagnostic::Code::NumberOutOfRange, {start, static_cast<uint32_t>(number.size())}, {std::string(number)});
+
+    return Token(kind, start, number, value.value_or(Token::Number()));
 }
 
-Token Scanner::_lex_char() {
-    auto[column, row] = _mark_start();
+std::optional<Token> Scanner::_lex_char() {
+    const auto start = _mark_start();
+
+    if (!_consume('\'')) return std::nullopt;
 
-    _consume('\'');
-    const auto consumed = _consume(_is_ascii, "'");
-    _consume('\'');
+    const auto consumed = _consume(Ascii, "'");
+    if (!consumed || !_consume('\'')) return std::nullopt;
 
-    return {Token::Type::Integer, column, row, std::to_string(consumed)};
+    const auto &[digits, size] = CHAR_VALUES[static_cast<unsigned char>(*consumed)];
+    const auto value = static_cast<int64_t>(static_cast<unsigned char>(*consumed));
+    return Token(Token::Type::Integer, start, std::string_view(digits.data(), size), value);
 }
 
-Token Scanner::_lex_special() {
-    auto[column, row] = _mark_start();
+std::optional<Token> Scanner::_lex_special() {
+    const auto start = _mark_start();
 
     const auto current = _current_char();
     if (auto special = Token::lookup_special(current)) {
         _next();
-        return {*special, column, row, _current_view()};
+        return Token(*special, start, _current_view());
     }
 
-    throw UnknownChar(current);
+    // Trailing whitespace leaves nothing to lex, thus there is no character to print.
+    const auto got = (_is_eol() ? std::string() : std::string(1, current));
+    _report(Diagnostic::Code::UnknownChar, {start, 1}, {got});
+    return std::nullopt;
 }
 
 char Scanner::_current_char() const {
-    return _current_line[_column];
+    if (_is_eol()) return '\0';
+    return _data[_line + _column];
 }
 
 bool Scanner::_is_eol() const {
-    return _column >= _current_line.size();
+    const auto position = _line + _column;
+    return position >= _data.size() || _data[position] == '\n';
 }
 
-Scanner::Location Scanner::_mark_start() {
+uint32_t Scanner::_mark_start() {
     _start = _column;
-    return Location{_column, _row};
+    return _position(_column);
 }
 
-std::string Scanner::_current_view() const {
-    return std::string(_current_line.substr(_start, (_column - _start)));
+uint32_t Scanner::_position(size_t column) const {
+    return static_cast<uint32_t>(_offset + _line + column);
+}
+
+std::string_view Scanner::_current_view() const {
+    return _data.substr(_line + _start, (_column - _start));
 }
 
 void Scanner::_next() {
@@ -225,98 +405,89 @@ void Scanner::_next() {
 }
 
 char Scanner::_peek() const {
-    if (_column >= _current_line.size()) return 0;
-    return _current_line[_column];
-}
-
-void Scanner::_consume(char expected) {
-    _consume([&](char input) { return input == expected; }, std::string(1, expected));
+    if (_is_eol()) return 0;
+    return _data[_line + _column];
 }
 
-bool Scanner::_try_consume(char expected) {
-    try {
-        _consume(expected);
-        return true;
-    } catch (const ScannerError &) {
+bool Scanner::_consume(char expected) {
+    const auto current = _current_char();
+    if (_is_eol()) {
+        _report(Diagnostic::Code::UnexpectedEndOfLine, {_position(_column), 0});
         return false;
     }
-}
 
-char Scanner::_consume(const std::function<bool(char)> &predicate, const std::string &expected) {
-    const auto current = _current_char();
-    if (_column >= _current_line.size()) {
-        throw UnexpectedEndOfLine();
+    if (current != expected) {
+        _report(Diagnostic::Code::UnexpectedChar, {_position(_column), 1}, {std::string(1, expected), std::string(1, current)});
+        return false;
     }
 
-    if (!predicate(current)) {
-        throw UnexpectedChar(expected, current);
-    }
+    _next();
+
+    return true;
+}
+
+bool Scanner::_try_consume(char expected) {
+    if (_is_eol() || _current_char() != expected) return false;
 
     _next();
 
-    return current;
+    return true;
 }
 
-std::optional<char> Scanner::_try_consume(const std::function<bool(char)> &predicate) {
-    try {
-        auto consumed = _consume(predicate, "");
-        return consumed;
-    } catch (const ScannerError &) {
+std::optional<char> Scanner::_consume(CharClass expected_class, std::string_view expected) {
+    const auto current = _current_char();
+    if (_is_eol()) {
+        _report(Diagnostic::Code::UnexpectedEndOfLine, {_position(_column), 0});
         return std::nullopt;
     }
-}
-
-size_t Scanner::_leading_spaces(const std::string &line) {
-    size_t count = 0;
 
-    for (const auto &current: line) {
-        if (current != ' ') break;
-        count++;
+    if (!_is(current, expected_class)) {
+        _report(Diagnostic::Code::UnexpectedChar, {_position(_column), 1}, {std::string(expected), std::string(1, current)});
+        return std::nullopt;
     }
 
-    return count;
-}
+    _next();
 
-bool Scanner::_is_digit(char input) {
-    return std::isdigit(static_cast<unsigned char>(input));
+    return current;
 }
 
-bool Scanner::_is_ident_start(char input) {
-    return std::isalpha(static_cast<unsigned char>(input)) || input == '_';
-}
+std::optional<char> Scanner::_try_consume(CharClass expected_class) {
+    if (_is_eol()) return std::nullopt;
 
-bool Scanner::_is_ident_inner(char input) {
-    return std::isalnum(static_cast<unsigned char>(input)) || input == '_';
-}
+    const auto current = _current_char();
+    if (!_is(current, expected_class)) return std::nullopt;
 
-bool Scanner::_is_not_newline(char input) {
-    return input != '\n';
+    _next();
+
+    return current;
 }
 
-bool Scanner::_is_ascii(char input) {
-    return static_cast<unsigned char>(input) <= 127;
+void Scanner::_report(Diagnostic::Code code, Span span, std::vector<std::string> args) {
+    _diagnostics.report({code, span, std::move(args)});
+    _failed = true;
+    _error = code;
 }
 
-bool Scanner::_is_space(char input) {
-    return std::isspace(static_cast<unsigned char>(input));
+size_t Scanner::_leading_spaces() const {
+    const auto *line = _data.data() + _line;
+    return simd::skip_spaces(line, _end()) - line;
 }
 
-bool Scanner::_is_hex(char input) {
-    return (input >= '0' && input <= '9') ||
-           (input >= 'a' && input <= 'f') ||
-           (input >= 'A' && input <= 'F');
+void Scanner::_skip_line(size_t offset) {
+    const auto *newline = simd::find_newline(_data.data() + _line + offset, _end());
+    _line = (newline == _end() ? _data.size() : newline - _data.data() + 1);
 }
 
-bool Scanner::_is_hex_expo(char input) {
-    return input == 'p' || input == 'P';
+const char *Scanner::_cursor() const {
+    return _data.data() + _line + _column;
 }
 
-bool Scanner::_is_expo(char input) {
-    return input == 'e' || input == 'E';
+const char *Scanner::_end() const {
+    return _data.data() + _data.size();
 }
 
-bool Scanner::_is_decimal_sign(char input) {
-    return input == '+' || input == '-';
+bool Scanner::_is(char input, CharClass expected_class) {
+    return CHAR_CLASSES[static_cast<unsigned char>(input)] & expected_class;
 }
 
 //==============================================================================
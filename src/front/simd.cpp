@@ -0,0 +1,175 @@
+#include "front/simd.hpp"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+using namespace arkoi::front;
+
+static bool is_space(char input) {
+    return input == ' ';
+}
+
+static bool is_identifier(char input) {
+    return (input >= 'a' && input <= 'z') ||
+           (input >= 'A' && input <= 'Z') ||
+           (input >= '0' && input <= '9') ||
+           input == '_';
+}
+
+static bool is_not_newline(char input) {
+    return input != '\n';
+}
+
+template<bool (*Predicate)(char)>
+static const char *skip_scalar(const char *begin, const char *end) {
+    while (begin != end && Predicate(*begin)) begin++;
+    return begin;
+}
+
+#if defined(__x86_64__)
+
+// Returns a mask of all bytes inside [low, high]. Bytes above 127 are negative as signed chars and thus never match,
+// which is fine as none of the ranges reach that far.
+static __m128i in_range_sse2(__m128i input, char low, char high) {
+    const auto above = _mm_cmpgt_epi8(input, _mm_set1_epi8(static_cast<char>(low - 1)));
+    const auto below = _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(high + 1)), input);
+    return _mm_and_si128(above, below);
+}
+
+static __m128i match_space_sse2(__m128i input) {
+    return _mm_cmpeq_epi8(input, _mm_set1_epi8(' '));
+}
+
+static __m128i match_identifier_sse2(__m128i input) {
+    // Setting the 0x20 bit maps upper- onto lowercase letters, without turning anything else into a letter.
+    const auto letter = in_range_sse2(_mm_or_si128(input, _mm_set1_epi8(0x20)), 'a', 'z');
+    const auto digit = in_range_sse2(input, '0', '9');
+    const auto underscore = _mm_cmpeq_epi8(input, _mm_set1_epi8('_'));
+    return _mm_or_si128(_mm_or_si128(letter, digit), underscore);
+}
+
+static __m128i match_not_newline_sse2(__m128i input) {
+    return _mm_xor_si128(_mm_cmpeq_epi8(input, _mm_set1_epi8('\n')), _mm_set1_epi8(-1));
+}
+
+template<__m128i (*Match)(__m128i), bool (*Predicate)(char)>
+static const char *skip_sse2(const char *begin, const char *end) {
+    while (end - begin >= 16) {
+        const auto input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(begin));
+        const auto mismatch = ~static_cast<unsigned>(_mm_movemask_epi8(Match(input))) & 0xFFFF;
+        if (mismatch) return begin + __builtin_ctz(mismatch);
+        begin += 16;
+    }
+
+    return skip_scalar<Predicate>(begin, end);
+}
+
+__attribute__((target("avx2")))
+static __m256i in_range_avx2(__m256i input, char low, char high) {
+    const auto above = _mm256_cmpgt_epi8(input, _mm256_set1_epi8(static_cast<char>(low - 1)));
+    const auto below = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(high + 1)), input);
+    return _mm256_and_si256(above, below);
+}
+
+__attribute__((target("avx2")))
+static __m256i match_space_avx2(__m256i input) {
+    return _mm256_cmpeq_epi8(input, _mm256_set1_epi8(' '));
+}
+
+__attribute__((target("avx2")))
+static __m256i match_identifier_avx2(__m256i input) {
+    const auto letter = in_range_avx2(_mm256_or_si256(input, _mm256_set1_epi8(0x20)), 'a', 'z');
+    const auto digit = in_range_avx2(input, '0', '9');
+    const auto underscore = _mm256_cmpeq_epi8(input, _mm256_set1_epi8('_'));
+    return _mm256_or_si256(_mm256_or_si256(letter, digit), underscore);
+}
+
+__attribute__((target("avx2")))
+static __m256i match_not_newline_avx2(__m256i input) {
+    return _mm256_xor_si256(_mm256_cmpeq_epi8(input, _mm256_set1_epi8('\n')), _mm256_set1_epi8(-1));
+}
+
+template<__m256i (*Match)(__m256i), __m128i (*Fallback)(__m128i), bool (*Predicate)(char)>
+__attribute__((target("avx2")))
+static const char *skip_avx2(const char *begin, const char *end) {
+    while (end - begin >= 32) {
+        const auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(begin));
+        const auto mismatch = ~static_cast<unsigned>(_mm256_movemask_epi8(Match(input)));
+        if (mismatch) return begin + __builtin_ctz(mismatch);
+        begin += 32;
+    }
+
+    return skip_sse2<Fallback, Predicate>(begin, end);
+}
+
+static bool has_avx2() {
+    static const bool supported = [] {
+        __builtin_cpu_init();
+        return __builtin_cpu_supports("avx2") != 0;
+    }();
+
+    return supported;
+}
+
+const char *simd::skip_spaces(const char *begin, const char *end) {
+    if (has_avx2()) return skip_avx2<match_space_avx2, match_space_sse2, is_space>(begin, end);
+    return skip_sse2<match_space_sse2, is_space>(begin, end);
+}
+
+const char *simd::skip_identifier(const char *begin, const char *end) {
+    if (has_avx2()) return skip_avx2<match_identifier_avx2, match_identifier_sse2, is_identifier>(begin, end);
+    return skip_sse2<match_identifier_sse2, is_identifier>(begin, end);
+}
+
+const char *simd::find_newline(const char *begin, const char *end) {
+    if (has_avx2()) return skip_avx2<match_not_newline_avx2, match_not_newline_sse2, is_not_newline>(begin, end);
+    return skip_sse2<match_not_newline_sse2, is_not_newline>(begin, end);
+}
+
+#else
+
+const char *simd::skip_spaces(const char *begin, const char *end) {
+    return skip_scalar<is_space>(begin, end);
+}
+
+const char *simd::skip_identifier(const char *begin, const char *end) {
+    return skip_scalar<is_identifier>(begin, end);
+}
+
+const char *simd::find_newline(const char *begin, const char *end) {
+    return skip_scalar<is_not_newline>(begin, end);
+}
+
+#endif
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,137 @@
+#include "front/source.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace arkoi::front;
+
+// Tokens only store a 32-bit offset into the source.
+static constexpr size_t MAX_SIZE = std::numeric_limits<uint32_t>::max();
+
+Source::Source(Source &&other) noexcept
+    : _buffer(std::move(other._buffer)),
+      _mapping(std::exchange(other._mapping, nullptr)),
+      _mapping_size(std::exchange(other._mapping_size, 0)) {}
+
+Source &Source::operator=(Source &&other) noexcept {
+    if (this == &other) return *this;
+
+    _unmap();
+
+    _buffer = std::move(other._buffer);
+    _mapping = std::exchange(other._mapping, nullptr);
+    _mapping_size = std::exchange(other._mapping_size, 0);
+
+    return *this;
+}
+
+Source::~Source() {
+    _unmap();
+}
+
+Source Source::read(const std::filesystem::path &path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) throw SourceError(path, "the file couldn't be opened");
+
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+
+    Source source;
+    source._buffer = std::move(buffer).str();
+    if (source._buffer.size() > MAX_SIZE) throw SourceError(path, "the file exceeds 4 GiB");
+
+    return source;
+}
+
+Source Source::map(const std::filesystem::path &path) {
+    const auto descriptor = ::open(path.c_str(), O_RDONLY);
+    if (descriptor == -1) throw SourceError(path, std::strerror(errno));
+
+    struct stat status{};
+    if (::fstat(descriptor, &status) == -1) {
+        const auto error = errno;
+        ::close(descriptor);
+        throw SourceError(path, std::strerror(error));
+    }
+
+    if (static_cast<size_t>(status.st_size) > MAX_SIZE) {
+        ::close(descriptor);
+        throw SourceError(path, "the file exceeds 4 GiB");
+    }
+
+    Source source;
+
+    // Mapping a zero-length file is an error, thus empty files are simply represented by an empty buffer.
+    const auto size = static_cast<size_t>(status.st_size);
+    if (size != 0) {
+        auto *mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (mapping == MAP_FAILED) {
+            const auto error = errno;
+            ::close(descriptor);
+            throw SourceError(path, std::strerror(error));
+        }
+
+        // The scanner walks the buffer strictly front to back.
+        ::madvise(mapping, size, MADV_SEQUENTIAL);
+
+        source._mapping = static_cast<const char *>(mapping);
+        source._mapping_size = size;
+    }
+
+    ::close(descriptor);
+
+    return source;
+}
+
+std::string_view Source::data() const {
+    if (_mapping) return {_mapping, _mapping_size};
+    return _buffer;
+}
+
+void Source::_unmap() {
+    if (!_mapping) return;
+
+    ::munmap(const_cast<char *>(_mapping), _mapping_size);
+    _mapping = nullptr;
+    _mapping_size = 0;
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
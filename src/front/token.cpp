@@ -1,40 +1,70 @@
 #include "front/token.hpp"
 
-#include <unordered_map>
+#include <array>
+#include <stdexcept>
 
 #include "utils/utils.hpp"
 
 using namespace arkoi::front;
 
-std::optional<Token::Type> Token::lookup_keyword(const std::string_view &value) {
-    static const std::unordered_map<std::string_view, Type> KEYWORDS = {
-        {"if",     Type::If},
-        {"else",   Type::Else},
-        {"fun",    Type::Fun},
-        {"return", Type::Return},
-        {"u8",     Type::U8},
-        {"s8",     Type::S8},
-        {"u16",    Type::U16},
-        {"s16",    Type::S16},
-        {"u32",    Type::U32},
-        {"s32",    Type::S32},
-        {"u64",    Type::U64},
-        {"s64",    Type::S64},
-        {"usize",  Type::USize},
-        {"ssize",  Type::SSize},
-        {"f64",    Type::F64},
-        {"f32",    Type::F32},
-        {"bool",   Type::Bool},
-        {"true",   Type::True},
-        {"false",  Type::False},
-    };
-
-    const auto keyword = KEYWORDS.find(value);
-    if (keyword != KEYWORDS.end()) {
-        return {keyword->second};
+struct Keyword {
+    std::string_view name;
+    Token::Type type;
+};
+
+static constexpr std::array KEYWORDS{
+    Keyword{"if",     Token::Type::If},
+    Keyword{"else",   Token::Type::Else},
+    Keyword{"fun",    Token::Type::Fun},
+    Keyword{"return", Token::Type::Return},
+    Keyword{"u8",     Token::Type::U8},
+    Keyword{"s8",     Token::Type::S8},
+    Keyword{"u16",    Token::Type::U16},
+    Keyword{"s16",    Token::Type::S16},
+    Keyword{"u32",    Token::Type::U32},
+    Keyword{"s32",    Token::Type::S32},
+    Keyword{"u64",    Token::Type::U64},
+    Keyword{"s64",    Token::Type::S64},
+    Keyword{"usize",  Token::Type::USize},
+    Keyword{"ssize",  Token::Type::SSize},
+    Keyword{"f64",    Token::Type::F64},
+    Keyword{"f32",    Token::Type::F32},
+    Keyword{"bool",   Token::Type::Bool},
+    Keyword{"true",   Token::Type::True},
+    Keyword{"false",  Token::Type::False},
+};
+
+static constexpr size_t KEYWORD_SLOTS = 32;
+
+// The keywords only differ in their length, first and last character, which is enough for a perfect hash.
+static constexpr size_t keyword_hash(std::string_view value) {
+    const auto first = static_cast<unsigned char>(value.front());
+    const auto last = static_cast<unsigned char>(value.back());
+    return (value.size() * 8 + first * 21 + last) % KEYWORD_SLOTS;
+}
+
+static constexpr auto KEYWORD_TABLE = [] {
+    std::array<Keyword, KEYWORD_SLOTS> table{};
+
+    for (const auto &keyword: KEYWORDS) {
+        auto &slot = table[keyword_hash(keyword.name)];
+
+        // Throwing during constant evaluation fails the build, thus a collision can never go unnoticed.
+        if (!slot.name.empty()) throw std::logic_error("The keyword hash is not perfect anymore.");
+
+        slot = keyword;
     }
 
-    return std::nullopt;
+    return table;
+}();
+
+std::optional<Token::Type> Token::lookup_keyword(const std::string_view &value) {
+    if (value.empty()) return std::nullopt;
+
+    const auto &keyword = KEYWORD_TABLE[keyword_hash(value)];
+    if (keyword.name != value) return std::nullopt;
+
+    return keyword.type;
 }
 
 std::optional<Token::Type> Token::lookup_special(char value) {
@@ -110,8 +140,7 @@ std::ostream &operator<<(std::ostream &os, const Token::Type &type) {
 std::ostream &operator<<(std::ostream &os, const Token &token) {
     os << to_string(token.type());
     os << "(contents=\"" << token.contents() << "\"";
-    os << ", column=" << token.column();
-    os << ", row=" << token.row() << ")";
+    os << ", offset=" << token.offset() << ")";
     return os;
 }
 
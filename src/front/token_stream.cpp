@@ -0,0 +1,64 @@
+#include "front/token_stream.hpp"
+
+#include <cassert>
+
+using namespace arkoi::front;
+
+const Token &TokenStream::peek(size_t offset) {
+    assert(offset < LOOKAHEAD);
+
+    while (_size <= offset) {
+        _buffer[(_head + _size) % LOOKAHEAD] = _pull();
+        _size++;
+    }
+
+    return *_buffer[(_head + offset) % LOOKAHEAD];
+}
+
+Token TokenStream::next() {
+    auto token = peek();
+
+    _head = (_head + 1) % LOOKAHEAD;
+    _size--;
+
+    return token;
+}
+
+Token TokenStream::_pull() {
+    if (_scanner) return _scanner->next_token();
+
+    // Behaves like the scanner, which keeps on returning the end of file once it has been reached.
+    if (_position >= _tokens.size()) return {Token::Type::EndOfFile, 0, ""};
+    return _tokens[_position++];
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
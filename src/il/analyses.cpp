@@ -1,64 +1,74 @@
-#include <ranges>
-
 #include "il/analyses.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <iterator>
+#include <limits>
+
 using namespace arkoi::il;
 using namespace arkoi;
 
-using State = BlockLivenessAnalysis::State;
+static constexpr auto NO_SLOT = std::numeric_limits<size_t>::max();
 
-State BlockLivenessAnalysis::merge(const std::vector<State> &predecessors) {
-    State result;
-    for (const auto &state: predecessors) result.insert(state.begin(), state.end());
-    return result;
-}
-
-State BlockLivenessAnalysis::initialize(Function &, BasicBlock &) {
-    return {};
-}
+OperandIndex::OperandIndex(Function &function) : _operands(function.vreg_count()) {
+    // The memory operands of a function are numbered consecutively while generating it, thus a flat table over their
+    // range is enough to map them.
+    auto minimum = std::numeric_limits<size_t>::max(), maximum = size_t{0};
+    for (auto &block: function) {
+        for (auto &instruction: block) {
+            auto operands = instruction.defs();
+            std::ranges::move(instruction.uses(), std::back_inserter(operands));
 
-State BlockLivenessAnalysis::transfer(BasicBlock &current, const State &state) {
-    State in = state;
+            for (const auto &operand: operands) {
+                const auto *memory = std::get_if<Memory>(&operand);
+                if (!memory) continue;
 
-    for (auto &instruction: std::ranges::reverse_view(current.instructions())) {
-        for (const auto &definition: instruction.defs()) {
-            if (std::holds_alternative<Immediate>(definition)) continue;
-            in.erase(definition);
+                minimum = std::min(minimum, memory->index());
+                maximum = std::max(maximum, memory->index());
+            }
         }
+    }
 
-        for (const auto &use: instruction.uses()) {
-            if (std::holds_alternative<Immediate>(use)) continue;
-            in.insert(use);
-        }
+    if (minimum <= maximum) {
+        _memories.assign(maximum - minimum + 1, NO_SLOT);
+        _memory_base = minimum;
     }
 
-    return in;
-}
+    for (const auto &parameter: function.parameters()) _insert(parameter);
 
-State InstructionLivenessAnalysis::merge(const std::vector<State> &predecessors) {
-    State result;
-    for (const auto &state: predecessors) result.insert(state.begin(), state.end());
-    return result;
-}
-
-State InstructionLivenessAnalysis::initialize(Function &, Instruction &) {
-    return {};
+    for (auto &block: function) {
+        for (auto &instruction: block) {
+            for (const auto &operand: instruction.defs()) _insert(operand);
+            for (const auto &operand: instruction.uses()) _insert(operand);
+        }
+    }
 }
 
-State InstructionLivenessAnalysis::transfer(Instruction &current, const State &state) {
-    State in = state;
-
-    for (const auto &definition: current.defs()) {
-        if (std::holds_alternative<Immediate>(definition)) continue;
-        in.erase(definition);
+std::optional<size_t> OperandIndex::find(const Operand &operand) const {
+    if (const auto *variable = std::get_if<Variable>(&operand)) {
+        return variable->id().index();
     }
 
-    for (const auto &use: current.uses()) {
-        if (std::holds_alternative<Immediate>(use)) continue;
-        in.insert(use);
+    if (const auto *memory = std::get_if<Memory>(&operand)) {
+        const auto slot = _memories[memory->index() - _memory_base];
+        assert(slot != NO_SLOT);
+        return slot;
     }
 
-    return in;
+    return std::nullopt;
+}
+
+void OperandIndex::_insert(const Operand &operand) {
+    if (const auto *variable = std::get_if<Variable>(&operand)) {
+        assert(variable->id().index() < _operands.size());
+        _operands[variable->id().index()] = *variable;
+    } else if (const auto *memory = std::get_if<Memory>(&operand)) {
+        auto &slot = _memories[memory->index() - _memory_base];
+        if (slot != NO_SLOT) return;
+
+        slot = _operands.size();
+        _operands.push_back(*memory);
+    }
 }
 
 //==============================================================================
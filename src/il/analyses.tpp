@@ -0,0 +1,97 @@
+template<typename Set>
+Set BlockLivenessAnalysis<Set>::initialize(Function &, BasicBlock &current) {
+    State uses(_operands.size()), definitions(_operands.size());
+
+    for (auto &instruction: std::ranges::reverse_view(current.instructions())) {
+        for (const auto &definition: instruction.defs()) {
+            const auto index = _operands.find(definition);
+            if (!index) continue;
+
+            definitions.set(*index);
+            uses.reset(*index);
+        }
+
+        for (const auto &use: instruction.uses()) {
+            const auto index = _operands.find(use);
+            if (!index) continue;
+
+            uses.set(*index);
+        }
+    }
+
+    _uses.insert_or_assign(&current, std::move(uses));
+    _definitions.insert_or_assign(&current, std::move(definitions));
+
+    return _lattice.top();
+}
+
+template<typename Set>
+Set BlockLivenessAnalysis<Set>::transfer(BasicBlock &current, const State &state) {
+    State in = state;
+    in -= _definitions.at(&current);
+    in |= _uses.at(&current);
+    return in;
+}
+
+template<typename Set>
+Set InstructionLivenessAnalysis<Set>::initialize(Function &, Instruction &) {
+    return _lattice.top();
+}
+
+template<typename Set>
+Set InstructionLivenessAnalysis<Set>::transfer(Instruction &current, const State &state) {
+    State in = state;
+    apply(current, in, _operands);
+    return in;
+}
+
+template<typename Set>
+void InstructionLivenessAnalysis<Set>::apply(Instruction &instruction, State &live, const OperandIndex &operands) {
+    for (const auto &definition: instruction.defs()) {
+        const auto index = operands.find(definition);
+        if (index) live.reset(*index);
+    }
+
+    for (const auto &use: instruction.uses()) {
+        const auto index = operands.find(use);
+        if (index) live.set(*index);
+    }
+}
+
+template<typename Set>
+typename LivenessReplay<Set>::Iterator &LivenessReplay<Set>::Iterator::operator++() {
+    InstructionLivenessAnalysis<Set>::apply(*_current, _replay->_live, _replay->_operands);
+    ++_current;
+    return *this;
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
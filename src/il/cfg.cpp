@@ -60,15 +60,20 @@ BlockIterator BlockIterator::operator++(int) {
     return temp;
 }
 
-Function::Function(std::string name, std::vector<Variable> parameters, sem::Type type, std::string entry_label,
-                   std::string exit_label)
-    : _parameters(std::move(parameters)), _name(std::move(name)), _type(std::move(type)) {
-    _entry = emplace_back(std::move(entry_label));
-    _exit = emplace_back(std::move(exit_label));
+Function::Function(Name name, std::vector<Variable> parameters, sem::Type type, Name entry_label, Name exit_label)
+    : _parameters(std::move(parameters)), _vreg_count(static_cast<uint32_t>(_parameters.size())), _name(name),
+      _type(std::move(type)) {
+    for (uint32_t index = 0; index < _vreg_count; index++) {
+        assert(_parameters[index].id() == VRegId(index));
+    }
+
+    _entry = emplace_back(entry_label);
+    _exit = emplace_back(exit_label);
 }
 
-Function::Function(const std::string &name, std::vector<Variable> parameters, sem::Type type)
-    : Function(name, std::move(parameters), std::move(type), name + "_entry", name + "_exit") {
+Function::Function(Name name, std::vector<Variable> parameters, sem::Type type)
+    : Function(name, std::move(parameters), std::move(type), Name(std::string(name.view()) + "_entry"),
+               Name(std::string(name.view()) + "_exit")) {
 }
 
 bool Function::is_leaf() {
@@ -81,6 +86,38 @@ bool Function::is_leaf() {
     return true;
 }
 
+std::vector<BasicBlock *> Function::postorder() const {
+    std::vector<BasicBlock *> order;
+    std::unordered_set<BasicBlock *> visited{_entry};
+
+    // Every block is kept on the stack together with the number of successors that were already looked at.
+    std::stack<std::pair<BasicBlock *, size_t>> stack;
+    stack.emplace(_entry, 0);
+
+    while (!stack.empty()) {
+        auto &[block, visited_successors] = stack.top();
+
+        BasicBlock *successor = nullptr;
+        if (visited_successors == 0) successor = block->next();
+        if (visited_successors == 1) successor = block->branch();
+
+        if (visited_successors == 2) {
+            order.push_back(block);
+            stack.pop();
+            continue;
+        }
+
+        visited_successors++;
+        if (!successor || !visited.insert(successor).second) continue;
+
+        stack.emplace(successor, 0);
+    }
+
+    if (!visited.contains(_exit)) order.insert(order.begin(), _exit);
+
+    return order;
+}
+
 bool Function::remove(BasicBlock *target) {
     assert(target->predecessors().empty());
 
@@ -28,7 +28,10 @@ void CFGPrinter::visit(Module &module) {
 
 void CFGPrinter::visit(Function &function) {
     _current_function = &function;
-    _liveness.run(function);
+    _liveness.reset();
+    _operands.emplace(function);
+    _liveness.emplace(*_operands);
+    _liveness->run(function);
 
     for(auto &block : function) {
         block.accept(*this);
@@ -63,11 +66,13 @@ void CFGPrinter::visit(BasicBlock &block) {
 
     _output << "\\l";
 
+    const auto print_operand = [&](size_t index) { _output << (*_operands)[index] << " "; };
+
     _output << "IN:  { ";
-    for(const auto &in : _liveness.in().at(&block)) _output << in << " ";
+    _liveness->in().at(&block).for_each(print_operand);
     _output << "}\\l";
     _output << "OUT: { ";
-    for(const auto &out : _liveness.out().at(&block)) _output << out << " ";
+    _liveness->out().at(&block).for_each(print_operand);
     _output << "}\\l";
 
     _output << "\"];\n";
@@ -1,21 +1,42 @@
 #include <cassert>
 
+template<typename Set>
+Set UnionLattice<Set>::bottom() const {
+    Value value(_size);
+    for (size_t index = 0; index < _size; index++) value.set(index);
+    return value;
+}
+
+template<typename Set>
+Set IntersectionLattice<Set>::top() const {
+    Value value(_size);
+    for (size_t index = 0; index < _size; index++) value.set(index);
+    return value;
+}
+
 template<DataflowPassConcept Pass>
 void DataflowAnalysis<Pass>::run(Function &function) {
     _out.clear();
     _in.clear();
+    _iterations = 0;
 
-    std::stack<BasicBlock *> worklist;
+    // Backward problems visit the successors of a block before the block itself and forward problems its
+    // predecessors, thus an acyclic graph converges after a single visit of every block.
+    auto order = function.postorder();
+    if constexpr (Pass::Direction == DataflowDirection::Forward) std::ranges::reverse(order);
 
-    for (auto &block: function) {
+    std::unordered_map<BasicBlock *, size_t> ranks;
+    for (size_t rank = 0; rank < order.size(); rank++) ranks.emplace(order[rank], rank);
+
+    for (auto *block: order) {
         if constexpr (Pass::Granularity == DataflowGranularity::Block) {
             if constexpr (Pass::Direction == DataflowDirection::Forward) {
-                _out[&block] = _pass->initialize(function, block);
+                _out[block] = _pass->initialize(function, *block);
             } else {
-                _in[&block] = _pass->initialize(function, block);
+                _in[block] = _pass->initialize(function, *block);
             }
         } else {
-            for (auto &instruction: block) {
+            for (auto &instruction: *block) {
                 if constexpr (Pass::Direction == DataflowDirection::Forward) {
                     _out[&instruction] = _pass->initialize(function, instruction);
                 } else {
@@ -23,133 +44,133 @@ void DataflowAnalysis<Pass>::run(Function &function) {
                 }
             }
         }
-
-        worklist.push(&block);
     }
 
+    // The worklist always hands out the block with the lowest rank and the bitmap keeps a block from being queued
+    // twice.
+    std::priority_queue<size_t, std::vector<size_t>, std::greater<>> worklist;
+    std::vector<bool> queued(order.size(), true);
+    for (size_t rank = 0; rank < order.size(); rank++) worklist.push(rank);
+
+    const auto enqueue = [&](BasicBlock *block) {
+        const auto found = ranks.find(block);
+        if (found == ranks.end() || queued[found->second]) return;
+
+        queued[found->second] = true;
+        worklist.push(found->second);
+    };
+
+    // Reused for every merge, thus the states are neither copied nor is a vector allocated per visit.
+    std::vector<const State *> states;
+
+    const auto merge = [&] {
+        if (states.empty()) return _pass->boundary(function);
+
+        auto result = *states.front();
+        for (const auto *state: states | std::views::drop(1)) _pass->lattice().meet(result, *state);
+        return result;
+    };
+
     while (!worklist.empty()) {
-        auto *block = worklist.top();
+        const auto rank = worklist.top();
         worklist.pop();
+        queued[rank] = false;
+
+        auto *block = order[rank];
+        _iterations++;
 
         // A requirement for every basic block.
         assert(!block->instructions().empty());
 
+        states.clear();
+
         if constexpr (Pass::Granularity == DataflowGranularity::Block) {
             auto &old_out = _out[block];
             auto &old_in = _in[block];
 
             if constexpr (Pass::Direction == DataflowDirection::Forward) {
-                std::vector<State> states;
                 for (auto *predecessor: block->predecessors()) {
-                    states.push_back(_out[predecessor]);
+                    if (ranks.contains(predecessor)) states.push_back(&_out[predecessor]);
                 }
 
-                auto new_in = _pass->merge(states);
+                auto new_in = merge();
                 auto new_out = _pass->transfer(*block, new_in);
                 old_in = std::move(new_in);
 
                 if (new_out == old_out) continue;
                 old_out = std::move(new_out);
 
-                if (block->next()) worklist.push(block->next());
-                if (block->branch()) worklist.push(block->branch());
+                if (block->next()) enqueue(block->next());
+                if (block->branch()) enqueue(block->branch());
             } else {
-                std::vector<State> states;
-                if (block->next()) states.push_back(_in[block->next()]);
-                if (block->branch()) states.push_back(_in[block->branch()]);
+                if (block->next()) states.push_back(&_in[block->next()]);
+                if (block->branch()) states.push_back(&_in[block->branch()]);
 
-                auto new_out = _pass->merge(states);
+                auto new_out = merge();
                 auto new_in = _pass->transfer(*block, new_out);
                 old_out = std::move(new_out);
 
                 if (new_in == old_in) continue;
                 old_in = std::move(new_in);
 
-                for (auto *predecessor: block->predecessors()) {
-                    worklist.push(predecessor);
-                }
+                for (auto *predecessor: block->predecessors()) enqueue(predecessor);
             }
         } else {
             if constexpr (Pass::Direction == DataflowDirection::Forward) {
-                std::vector<State> states;
                 for (auto *predecessor: block->predecessors()) {
-                    if (predecessor->instructions().empty()) continue;
+                    if (!ranks.contains(predecessor)) continue;
 
                     const auto &last_instruction = predecessor->instructions().back();
-                    states.push_back(_out[&last_instruction]);
+                    states.push_back(&_out[&last_instruction]);
                 }
 
-                auto &first_instruction = block->instructions().front();
-                auto new_in = _pass->merge(states);
-                auto new_out = _pass->transfer(first_instruction, new_in);
-                _in[&first_instruction] = std::move(new_in);
-
-                auto changed = new_out != _out[&first_instruction];
-                _out[&first_instruction] = std::move(new_out);
-
-                for (auto it = block->instructions().begin() + 1; it != block->instructions().end(); ++it) {
-                    auto &previous_instruction = *(it - 1);
-                    auto &instruction = *it;
-
-                    std::vector<State> states;
-                    states.push_back(_out[&previous_instruction]);
-
-                    auto new_in = _pass->merge(states);
+                auto changed = false;
+                for (auto &instruction: *block) {
+                    auto new_in = merge();
                     auto new_out = _pass->transfer(instruction, new_in);
                     _in[&instruction] = std::move(new_in);
 
-                    changed |= new_out != _out[&instruction];
-                    _out[&instruction] = std::move(new_out);
+                    auto &old_out = _out[&instruction];
+                    changed |= new_out != old_out;
+                    old_out = std::move(new_out);
+
+                    states.assign(1, &old_out);
                 }
 
                 if (!changed) continue;
 
-                for (auto *predecessor: block->predecessors()) {
-                    worklist.push(predecessor);
-                }
+                if (block->next()) enqueue(block->next());
+                if (block->branch()) enqueue(block->branch());
             } else {
-                std::vector<State> states;
                 if (block->next()) {
                     assert(!block->next()->instructions().empty());
 
                     auto &first_instruction = block->next()->instructions().front();
-                    states.push_back(_in[&first_instruction]);
+                    states.push_back(&_in[&first_instruction]);
                 }
                 if (block->branch()) {
                     assert(!block->branch()->instructions().empty());
 
                     auto &first_instruction = block->branch()->instructions().front();
-                    states.push_back(_in[&first_instruction]);
+                    states.push_back(&_in[&first_instruction]);
                 }
 
-                auto &last_instruction = block->instructions().back();
-                auto new_out = _pass->merge(states);
-                auto new_in = _pass->transfer(last_instruction, new_out);
-                _out[&last_instruction] = std::move(new_out);
-
-                auto changed = new_in != _in[&last_instruction];
-                _in[&last_instruction] = std::move(new_in);
-
-                for (auto it = block->instructions().rbegin() + 1; it != block->instructions().rend(); ++it) {
-                    auto &previous_instruction = *(it - 1);
-                    auto &instruction = *it;
-
-                    std::vector<State> states;
-                    states.push_back(_in[&previous_instruction]);
-
-                    auto new_out = _pass->merge(states);
+                auto changed = false;
+                for (auto &instruction: std::ranges::reverse_view(block->instructions())) {
+                    auto new_out = merge();
                     auto new_in = _pass->transfer(instruction, new_out);
                     _out[&instruction] = std::move(new_out);
 
-                    changed |= new_in != _in[&instruction];
-                    _in[&instruction] = std::move(new_in);
+                    auto &old_in = _in[&instruction];
+                    changed |= new_in != old_in;
+                    old_in = std::move(new_in);
+
+                    states.assign(1, &old_in);
                 }
 
                 if (!changed) continue;
 
-                for (auto *predecessor: block->predecessors()) {
-                    worklist.push(predecessor);
-                }
+                for (auto *predecessor: block->predecessors()) enqueue(predecessor);
             }
         }
     }
@@ -9,12 +9,22 @@
 using namespace arkoi::il;
 using namespace arkoi;
 
-Module Generator::generate(ast::Program &node) {
-    Generator generator;
+Module Generator::generate(ast::Program &node, sem::SymbolArena &symbols) {
+    Generator generator(symbols);
     node.accept(generator);
     return generator.module();
 }
 
+Function &Generator::lower(ast::Function &node) {
+    _module = {};
+
+    // The symbols of the locals are only created once the body is resolved, thus after the generator.
+    _allocas.resize(_symbols.size());
+
+    node.accept(*this);
+    return *_module.begin();
+}
+
 void Generator::visit(ast::Program &node) {
     for (const auto &item: node.statements()) {
         item->accept(*this);
@@ -24,13 +34,13 @@ void Generator::visit(ast::Program &node) {
 void Generator::visit(ast::Function &node) {
     // Resetting the variables for each function
     _temp_index = 0;
-    _allocas.clear();
 
-    auto &function_symbol = std::get<sem::Function>(*node.name().symbol());
+    auto &function_symbol = std::get<sem::Function>(_symbols[node.name().symbol()]);
 
     std::vector<Variable> parameters;
-    for (auto &parameter: function_symbol.parameters()) {
-        parameters.emplace_back(parameter->name(), parameter->type());
+    for (const auto &symbol: function_symbol.parameters()) {
+        const auto &parameter = std::get<sem::Variable>(_symbols[symbol]);
+        parameters.emplace_back(VRegId(static_cast<uint32_t>(parameters.size())), parameter.name(), parameter.type());
     }
 
     auto entry_label = _make_label_symbol();
@@ -48,14 +58,14 @@ void Generator::visit(ast::Function &node) {
 
     for (auto &parameter: node.parameters()) {
         auto alloca_temp = _make_memory(parameter.type());
-        _allocas.emplace(parameter.name().symbol(), alloca_temp);
+        _allocas[parameter.name().symbol().index()] = alloca_temp;
         _current_block->emplace_back<Alloca>(alloca_temp);
     }
 
-    for (auto &parameter: node.parameters()) {
-        auto destination = _allocas.at(parameter.name().symbol());
-        auto source = Variable(parameter.name().value().contents(), parameter.type());
-        _current_block->emplace_back<Store>(destination, source);
+    for (size_t index = 0; index < node.parameters().size(); index++) {
+        auto &parameter = node.parameters()[index];
+        auto destination = _allocas[parameter.name().symbol().index()].value();
+        _current_block->emplace_back<Store>(destination, function.parameters()[index]);
     }
 
     node.block()->accept(*this);
@@ -75,8 +85,7 @@ void Generator::visit(ast::Block &node) {
         statement->accept(*this);
 
         // Stop generating instructions for the block after a return statement.
-        auto *_return = dynamic_cast<ast::Return *>(statement.get());
-        if (_return) break;
+        if (statement->tag() == ast::Node::Tag::Return) break;
     }
 
     // There should never be blocks that can be empty at any time. This would break dataflow analysis and other stuff.
@@ -94,24 +103,22 @@ void Generator::visit(ast::Immediate &node) {
 }
 
 void Generator::visit_integer(const ast::Immediate &node) {
-    const auto &number_string = node.value().contents();
-
-    const auto sign = !number_string.starts_with('-');
+    const auto value = std::get<int64_t>(node.value().number());
+    const auto sign = !node.value().contents().starts_with('-');
 
     Immediate immediate;
     if (sign) {
-        auto value = std::stoll(number_string);
         if (value > std::numeric_limits<int32_t>::max()) {
-            immediate = static_cast<int64_t>(value);
+            immediate = value;
         } else {
             immediate = static_cast<int32_t>(value);
         }
     } else {
-        auto value = std::stoull(number_string);
-        if (value > std::numeric_limits<uint32_t>::max()) {
-            immediate = static_cast<uint64_t>(value);
+        const auto bits = static_cast<uint64_t>(value);
+        if (bits > std::numeric_limits<uint32_t>::max()) {
+            immediate = bits;
         } else {
-            immediate = static_cast<uint32_t>(value);
+            immediate = static_cast<uint32_t>(bits);
         }
     }
 
@@ -121,13 +128,11 @@ void Generator::visit_integer(const ast::Immediate &node) {
 }
 
 void Generator::visit_floating(const ast::Immediate &node) {
-    const auto &number_string = node.value().contents();
-
-    const auto value = std::stold(number_string);
+    const auto value = std::get<double>(node.value().number());
 
     Immediate immediate;
     if (value > std::numeric_limits<float>::max()) {
-        immediate = static_cast<double>(value);
+        immediate = value;
     } else {
         immediate = static_cast<float>(value);
     }
@@ -146,7 +151,7 @@ void Generator::visit_boolean(const ast::Immediate &node) {
 
 void Generator::visit(ast::Variable &node) {
     auto temp = _make_memory(node.type());
-    _allocas.emplace(node.name().symbol(), temp);
+    _allocas[node.name().symbol().index()] = temp;
     _current_block->emplace_back<Alloca>(temp);
 
     // This will set _current_operand
@@ -179,9 +184,9 @@ void Generator::visit(ast::Identifier &node) {
     // TODO(timo): In the future there will be local/global and parameter variables,
     //             thus they need to be searched in such order: local, parameter, global.
     //             For now only parameter variables exist.
-    const auto &variable = std::get<sem::Variable>(*node.symbol());
+    const auto &variable = std::get<sem::Variable>(_symbols[node.symbol()]);
 
-    auto alloca_temp = _allocas.at(node.symbol());
+    auto alloca_temp = _allocas[node.symbol().index()].value();
     auto temp = _make_temporary(variable.type());
     _current_block->emplace_back<Load>(temp, alloca_temp);
     _current_operand = temp;
@@ -208,7 +213,7 @@ void Generator::visit(ast::Assign &node) {
     node.expression()->accept(*this);
     auto expression = _current_operand;
 
-    auto alloca_temp = _allocas.at(node.name().symbol());
+    auto alloca_temp = _allocas[node.name().symbol().index()].value();
     _current_block->emplace_back<Store>(alloca_temp, expression);
 }
 
@@ -224,7 +229,7 @@ void Generator::visit(ast::Cast &node) {
 }
 
 void Generator::visit(ast::Call &node) {
-    const auto &function = std::get<sem::Function>(*node.name().symbol());
+    const auto &function = std::get<sem::Function>(_symbols[node.name().symbol()]);
 
     std::vector<Operand> arguments;
     for (const auto &argument: node.arguments()) {
@@ -302,12 +307,13 @@ void Generator::visit(ast::If &node) {
     }
 }
 
-std::string Generator::_make_label_symbol() {
-    return "L" + to_string(_label_index++);
+Name Generator::_make_label_symbol() {
+    return Name("L" + to_string(_label_index++));
 }
 
 Variable Generator::_make_temporary(const sem::Type &type) {
-    return {"$", type, ++_temp_index};
+    static const Name temporary("$");
+    return {_current_function->make_vreg(), temporary, type, ++_temp_index};
 }
 
 Memory Generator::_make_memory(const sem::Type &type) {
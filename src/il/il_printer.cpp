@@ -15,6 +15,13 @@ std::stringstream ILPrinter::print(Module &module) {
     return output;
 }
 
+std::stringstream ILPrinter::print(Function &function) {
+    std::stringstream output;
+    ILPrinter printer(output);
+    printer.visit(function);
+    return output;
+}
+
 void ILPrinter::visit(Module &module) {
     for (auto &function: module) {
         function.accept(*this);
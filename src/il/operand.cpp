@@ -20,12 +20,11 @@ bool Memory::operator!=(const Memory &rhs) const {
 }
 
 bool Variable::operator<(const Variable &rhs) const {
-    if (_name != rhs._name) return _name < rhs._name;
-    return _version < rhs._version;
+    return _id < rhs._id;
 }
 
 bool Variable::operator==(const Variable &rhs) const {
-    return _name == rhs._name && _version == rhs._version;
+    return _id == rhs._id;
 }
 
 bool Variable::operator!=(const Variable &rhs) const {
@@ -34,13 +33,13 @@ bool Variable::operator!=(const Variable &rhs) const {
 
 sem::Type Immediate::type() const {
     return std::visit(match{
-        [](const double &) -> sem::Type { return sem::Floating(Size::QWORD); },
-        [](const float &) -> sem::Type { return sem::Floating(Size::DWORD); },
-        [](const bool &) -> sem::Type { return sem::Boolean(); },
-        [](const uint32_t &) -> sem::Type { return sem::Integral(Size::DWORD, false); },
-        [](const int32_t &) -> sem::Type { return sem::Integral(Size::DWORD, true); },
-        [](const uint64_t &) -> sem::Type { return sem::Integral(Size::QWORD, false); },
-        [](const int64_t &) -> sem::Type { return sem::Integral(Size::QWORD, true); },
+        [](const double &) -> sem::Type { return sem::TypeId::F64; },
+        [](const float &) -> sem::Type { return sem::TypeId::F32; },
+        [](const bool &) -> sem::Type { return sem::TypeId::Bool; },
+        [](const uint32_t &) -> sem::Type { return sem::TypeId::U32; },
+        [](const int32_t &) -> sem::Type { return sem::TypeId::S32; },
+        [](const uint64_t &) -> sem::Type { return sem::TypeId::U64; },
+        [](const int64_t &) -> sem::Type { return sem::TypeId::S64; },
     }, *this);
 }
 
@@ -79,9 +78,7 @@ sem::Type Operand::type() const {
 namespace std {
 
 size_t hash<Variable>::operator()(const Variable &variable) const noexcept {
-    const size_t name_hash = std::hash<std::string>{}(variable.name());
-    const size_t generation_hash = std::hash<size_t>{}(variable.version());
-    return name_hash ^ (generation_hash << 1);
+    return std::hash<uint32_t>{}(variable.id().index());
 }
 
 size_t hash<Memory>::operator()(const Memory &memory) const noexcept {
@@ -1,11 +1,13 @@
+#include <filesystem>
 #include <fstream>
 #include <iostream>
-#include <sstream>
+#include <optional>
 
 #include "argparse/argparse.hpp"
 
 #include "front/parser.hpp"
 #include "front/scanner.hpp"
+#include "front/source.hpp"
 #include "il/cfg_printer.hpp"
 #include "il/generator.hpp"
 #include "il/il_printer.hpp"
@@ -14,6 +16,7 @@
 #include "opt/dead_code_elimination.hpp"
 #include "opt/pass.hpp"
 #include "opt/simplify_cfg.hpp"
+#include "sem/fused_resolver.hpp"
 #include "sem/name_resolver.hpp"
 #include "sem/type_resolver.hpp"
 #include "x86_64/generator.hpp"
@@ -35,6 +38,77 @@ void dump_cfg(const std::string &base_path, il::Module &module) {
     if (WEXITSTATUS(assemble_result) != 0) exit(1);
 }
 
+bool stream_functions(std::vector<front::Parser::Part> &parts, sem::SymbolArena &symbols,
+                      DiagnosticEngine &diagnostics, const std::string &base_path, bool output_il, bool output_asm) {
+    std::optional<std::ofstream> org_file, opt_file, asm_file;
+    if (output_il) {
+        org_file.emplace(base_path + "_org.il");
+        opt_file.emplace(base_path + "_opt.il");
+    }
+    if (output_asm) asm_file.emplace(base_path + ".asm");
+
+    opt::PassManager manager;
+    manager.add<opt::ConstantFolding>();
+    manager.add<opt::ConstantPropagation>();
+    manager.add<opt::DeadCodeElimination>();
+    manager.add<opt::SimplifyCFG>();
+
+    x86_64::Generator assembly_generator;
+    il::Generator il_generator(symbols);
+
+    // Only the prototypes are resolved up front, as every function may call any other one.
+    sem::FusedResolver resolver(symbols, diagnostics);
+    for (auto &part: parts) resolver.declare(part.program, *part.arena);
+
+    for (auto &part: parts) {
+        resolver.define(part.program, *part.arena);
+
+        // After the first error the remaining parts are only resolved for their diagnostics.
+        if (!resolver.has_failed()) {
+            for (const auto &item: part.program.statements()) {
+                auto *node = ast::node_cast<ast::Function>(item);
+                if (!node) continue;
+
+                auto &function = il_generator.lower(*node);
+
+                if (org_file) *org_file << il::ILPrinter::print(function).str();
+
+                manager.run(function);
+
+                if (opt_file) *opt_file << il::ILPrinter::print(function).str();
+
+                assembly_generator.generate(function);
+
+                // The text is written out right away, such that only the data section is kept until the end.
+                const auto text = assembly_generator.take_text();
+                if (asm_file) *asm_file << text.str();
+            }
+        }
+
+        // Only the prototype symbols are needed by the following parts, thus the nodes are destroyed right away.
+        part.arena.reset();
+    }
+
+    resolver.finish();
+
+    if (resolver.has_failed()) {
+        // Just like without streaming, no output is left behind for a program which doesn't compile.
+        org_file.reset();
+        opt_file.reset();
+        asm_file.reset();
+        if (output_il) {
+            std::filesystem::remove(base_path + "_org.il");
+            std::filesystem::remove(base_path + "_opt.il");
+        }
+        if (output_asm) std::filesystem::remove(base_path + ".asm");
+
+        return false;
+    }
+
+    if (asm_file) *asm_file << assembly_generator.take_data().str();
+    return true;
+}
+
 std::string get_base_path(const std::string &path) {
     auto last_dot = path.find_last_of('.');
     if (last_dot == std::string::npos || path.substr(last_dot) != ".ark") {
@@ -55,6 +129,17 @@ int main(int argc, char* argv[]) {
             .help("print the assembly code to a file ending with \".asm\".");
     argument_parser.add_argument("-cfg", "--output-cfg").flag()
             .help("print the control flow graph to a file ending with \".dot\".");
+    argument_parser.add_argument("-mmap", "--memory-map").flag()
+            .help("map the source file into memory instead of reading it into a buffer.");
+    argument_parser.add_argument("-j", "--jobs").default_value(size_t{1}).scan<'u', size_t>()
+            .help("the amount of threads used to parse and resolve the top-level functions in parallel.");
+    argument_parser.add_argument("--stream").flag()
+            .help("resolve, lower, optimize and emit one function at a time and free its nodes right afterwards, "
+                  "instead of keeping the whole program alive.");
+    argument_parser.add_argument("--fused-resolver").flag()
+            .help("resolve the names and types in a single serial traversal instead of two separate passes.");
+    argument_parser.add_argument("--max-errors").default_value(size_t{20}).scan<'u', size_t>()
+            .help("stop compiling after this amount of errors, where 0 means no limit.");
 
     try {
         argument_parser.parse_args(argc, argv);
@@ -70,36 +155,102 @@ int main(int argc, char* argv[]) {
     const auto output_il = argument_parser.get<bool>("--output-il");
     const auto output_asm = argument_parser.get<bool>("--output-asm");
     const auto output_cfg = argument_parser.get<bool>("--output-cfg");
+    const auto memory_map = argument_parser.get<bool>("--memory-map");
+    const auto jobs = argument_parser.get<size_t>("--jobs");
+    const auto stream = argument_parser.get<bool>("--stream");
+    const auto fused_resolver = argument_parser.get<bool>("--fused-resolver");
+    const auto max_errors = argument_parser.get<size_t>("--max-errors");
+
+    // The control flow graph is rendered as a single graph, which needs the whole module.
+    if (stream && output_cfg) {
+        std::cerr << "The control flow graph can't be printed while streaming the functions." << std::endl;
+        return 1;
+    }
 
-    std::string source;
-    {
-        std::stringstream buffer;
-        std::ifstream file(input_path);
-        buffer << file.rdbuf();
-        source = buffer.str();
+    std::optional<front::Source> source;
+    try {
+        source = (memory_map ? front::Source::map(input_path) : front::Source::read(input_path));
+    } catch (const front::SourceError &error) {
+        std::cerr << error.what() << std::endl;
+        return 1;
     }
 
     std::cout << "~~~~~~~~~~~~         Lex & Scan           ~~~~~~~~~~~~ " << std::endl;
 
-    front::Scanner scanner(source);
-    front::Parser parser(scanner.tokenize());
-    auto program = parser.parse_program();
+    ast::AstArena arena;
+    sem::SymbolArena symbols;
+    DiagnosticEngine diagnostics(max_errors);
+
+    std::optional<ThreadPool> pool;
+    if (jobs > 1) pool.emplace(jobs);
+
+    if (stream) {
+        auto parts = pool ? front::Parser::parse_parts(source->data(), diagnostics, *pool)
+                          : front::Parser::parse_parts(source->data(), diagnostics);
+        if (!parts) {
+            diagnostics.render(std::cerr, LineTable(source->data()));
+            exit(1);
+        }
+
+        std::cout << "~~~~~~~~~~~~     Streaming Functions      ~~~~~~~~~~~~" << std::endl;
 
-    if (scanner.has_failed() || parser.has_failed()) exit(1);
+        // Every function is resolved by the fused resolver right before being lowered, thus its nodes don't have to
+        // outlive it.
+        if (!stream_functions(*parts, symbols, diagnostics, base_path, output_il, output_asm)) {
+            diagnostics.render(std::cerr, LineTable(source->data()));
+            exit(1);
+        }
 
-    std::cout << "~~~~~~~~~~~~        Name Resolver         ~~~~~~~~~~~~" << std::endl;
+        return 0;
+    }
 
-    auto name_resolver = sem::NameResolver::resolve(program);
-    if (name_resolver.has_failed()) exit(1);
+    std::optional<ast::Program> program;
+    if (pool) {
+        program = front::Parser::parse_program(source->data(), arena, diagnostics, *pool);
+    } else {
+        front::Scanner scanner(source->data(), diagnostics);
+        front::Parser parser(scanner, arena, diagnostics);
+        program = parser.parse_program();
 
-    std::cout << "~~~~~~~~~~~~        Type Resolver         ~~~~~~~~~~~~" << std::endl;
+        if (scanner.has_failed() || parser.has_failed()) program.reset();
+    }
 
-    auto type_resolver = sem::TypeResolver::resolve(program);
-    if (type_resolver.has_failed()) exit(1);
+    if (!program) {
+        diagnostics.render(std::cerr, LineTable(source->data()));
+        exit(1);
+    }
+
+    if (fused_resolver) {
+        std::cout << "~~~~~~~~~~~~     Name & Type Resolver     ~~~~~~~~~~~~" << std::endl;
+
+        auto resolver = sem::FusedResolver::resolve(*program, arena, symbols, diagnostics);
+        if (resolver.has_failed()) {
+            diagnostics.render(std::cerr, LineTable(source->data()));
+            exit(1);
+        }
+    } else {
+        std::cout << "~~~~~~~~~~~~        Name Resolver         ~~~~~~~~~~~~" << std::endl;
+
+        auto name_resolver = pool ? sem::NameResolver::resolve(*program, symbols, diagnostics, *pool)
+                                  : sem::NameResolver::resolve(*program, symbols, diagnostics);
+        if (name_resolver.has_failed()) {
+            diagnostics.render(std::cerr, LineTable(source->data()));
+            exit(1);
+        }
+
+        std::cout << "~~~~~~~~~~~~        Type Resolver         ~~~~~~~~~~~~" << std::endl;
+
+        auto type_resolver = pool ? sem::TypeResolver::resolve(*program, arena, symbols, diagnostics, *pool)
+                                  : sem::TypeResolver::resolve(*program, arena, symbols, diagnostics);
+        if (type_resolver.has_failed()) {
+            diagnostics.render(std::cerr, LineTable(source->data()));
+            exit(1);
+        }
+    }
 
     std::cout << "~~~~~~~~~~~~    Intermediate Language     ~~~~~~~~~~~~" << std::endl;
 
-    auto module = il::Generator::generate(program);
+    auto module = il::Generator::generate(*program, symbols);
 
     if (output_il) {
         auto output = il::ILPrinter::print(module);
@@ -31,7 +31,7 @@ il::Immediate ConstantFolding::_cast(il::Cast &instruction) {
 }
 
 il::Immediate ConstantFolding::_evaluate_cast(const sem::Type &to, auto expression) {
-    return std::visit(match{
+    return to.visit(match{
         [&](const sem::Integral &type) -> il::Immediate {
             switch (type.size()) {
                 case Size::BYTE:
@@ -55,7 +55,7 @@ il::Immediate ConstantFolding::_evaluate_cast(const sem::Type &to, auto expressi
         [&](const sem::Boolean &) -> il::Immediate {
             return static_cast<bool>(expression);
         }
-    }, to);
+    });
 }
 
 //==============================================================================
@@ -26,6 +26,24 @@ void PassManager::run(il::Module &module) const {
     }
 }
 
+void PassManager::run(il::Function &function) const {
+    while (true) {
+        bool changed = false;
+
+        for (const auto &pass: _passes) {
+            changed |= pass->enter_function(function);
+
+            for (auto &block: function) {
+                changed |= pass->on_block(block);
+            }
+
+            changed |= pass->exit_function(function);
+        }
+
+        if (!changed) break;
+    }
+}
+
 //==============================================================================
 // BSD 3-Clause License
 //
@@ -0,0 +1,87 @@
+#include "sem/fused_resolver.hpp"
+
+#include "sem/name_resolver.hpp"
+#include "sem/type_resolver.hpp"
+
+using namespace arkoi::sem;
+
+FusedResolver::FusedResolver(SymbolArena &symbols, DiagnosticEngine &diagnostics)
+    : _type_diagnostics(diagnostics.limit()), _diagnostics(diagnostics), _symbols(symbols),
+      _names(symbols, diagnostics) {
+    _names._table.enter_scope();
+}
+
+FusedResolver FusedResolver::resolve(ast::Program &node, ast::AstArena &arena, SymbolArena &symbols,
+                                     DiagnosticEngine &diagnostics) {
+    FusedResolver resolver(symbols, diagnostics);
+    resolver.declare(node, arena);
+    resolver.define(node, arena);
+    resolver.finish();
+    return resolver;
+}
+
+void FusedResolver::declare(ast::Program &part, ast::AstArena &arena) {
+    TypeResolver types(arena, _symbols, _type_diagnostics);
+    types._names = &_names;
+
+    // The signature is typed right after its name, as it only depends on the prototype itself. The name and type
+    // diagnostics are reported to different engines, thus their order is the same as with two separate loops.
+    for (const auto &item: part.statements()) {
+        auto *function = ast::node_cast<ast::Function>(item);
+        if (!function) continue;
+
+        _names.visit_as_prototype(*function);
+        types.visit_as_prototype(*function);
+    }
+
+    _types_failed |= types.has_failed();
+}
+
+void FusedResolver::define(ast::Program &part, ast::AstArena &arena) {
+    TypeResolver types(arena, _symbols, _type_diagnostics);
+    types._names = &_names;
+
+    for (const auto &item: part.statements()) {
+        if (_diagnostics.is_full()) break;
+        item->accept(types);
+    }
+
+    _types_failed |= types.has_failed();
+}
+
+void FusedResolver::finish() {
+    _names._table.exit_scope();
+
+    if (!_names.has_failed() && _types_failed) _diagnostics.absorb(std::move(_type_diagnostics));
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -1,32 +1,111 @@
 #include "sem/name_resolver.hpp"
 
+#include <algorithm>
+#include <future>
+
 #include "ast/nodes.hpp"
 #include "utils/utils.hpp"
 
 using namespace arkoi::sem;
 
-NameResolver NameResolver::resolve(ast::Program &node) {
-    NameResolver resolver;
+static constexpr size_t BATCHES_PER_THREAD = 4;
+
+NameResolver NameResolver::resolve(ast::Program &node, SymbolArena &symbols, DiagnosticEngine &diagnostics) {
+    NameResolver resolver(symbols, diagnostics);
 
     node.accept(resolver);
 
     return resolver;
 }
 
+NameResolver NameResolver::resolve(ast::Program &node, SymbolArena &symbols, DiagnosticEngine &diagnostics,
+                                   ThreadPool &pool) {
+    struct Batch {
+        std::span<ast::Node *> statements;
+        SymbolId slot;
+    };
+
+    struct ResolvedBatch {
+        DiagnosticEngine diagnostics;
+        bool failed;
+    };
+
+    NameResolver resolver(symbols, diagnostics);
+    resolver._table.enter_scope();
+
+    for (const auto &item: node.statements()) {
+        auto *function = ast::node_cast<ast::Function>(item);
+        if (function) resolver.visit_as_prototype(*function);
+    }
+
+    // A few batches per thread balance out functions of different sizes, without paying for a task per function.
+    const auto statements = node.statements();
+    const auto batch_size = std::max<size_t>(1, statements.size() / (pool.size() * BATCHES_PER_THREAD));
+
+    // The parameters and locals are reserved in source order, thus the symbols get the same ids as if they were
+    // resolved serially. This has to happen up front, as reserving may move the symbols the tasks are reading.
+    std::vector<Batch> batches;
+    for (size_t start = 0; start < statements.size(); start += batch_size) {
+        const auto batch = statements.subspan(start, std::min(batch_size, statements.size() - start));
+
+        size_t count = 0;
+        for (const auto &item: batch) {
+            auto *function = ast::node_cast<ast::Function>(item);
+            if (function) count += function->parameters().size() + function->locals();
+        }
+
+        batches.push_back({batch, symbols.reserve(count)});
+    }
+
+    const auto limit = diagnostics.limit();
+
+    std::vector<std::future<ResolvedBatch>> resolved;
+    resolved.reserve(batches.size());
+    for (const auto &batch: batches) {
+        resolved.push_back(pool.submit([&batch, &symbols, &globals = resolver._table, limit] {
+            // The engines are not synchronized, thus every batch reports to its own one.
+            DiagnosticEngine batch_diagnostics(limit);
+
+            NameResolver batch_resolver(symbols, globals, batch.slot, batch_diagnostics);
+            for (const auto &item: batch.statements) {
+                if (batch_diagnostics.is_full()) break;
+                item->accept(batch_resolver);
+            }
+
+            return ResolvedBatch{std::move(batch_diagnostics), batch_resolver.has_failed()};
+        }));
+    }
+
+    // The tasks reference the batches and the global table, thus all of them must be done before an exception may
+    // unwind.
+    for (const auto &future: resolved) future.wait();
+
+    for (auto &future: resolved) {
+        auto batch = future.get();
+        diagnostics.absorb(std::move(batch.diagnostics));
+        resolver._failed |= batch.failed;
+    }
+
+    resolver._table.exit_scope();
+
+    return resolver;
+}
+
 void NameResolver::visit(ast::Program &node) {
-    _scopes.push(node.table());
+    _table.enter_scope();
 
     // At first all function prototypes are name resolved.
     for (const auto &item: node.statements()) {
-        auto *function = dynamic_cast<ast::Function *>(item.get());
+        auto *function = ast::node_cast<ast::Function>(item);
         if (function) visit_as_prototype(*function);
     }
 
     for (const auto &item: node.statements()) {
+        if (_diagnostics.is_full()) break;
         item->accept(*this);
     }
 
-    _scopes.pop();
+    _table.exit_scope();
 }
 
 void NameResolver::visit_as_prototype(ast::Function &node) {
@@ -36,21 +115,23 @@ void NameResolver::visit_as_prototype(ast::Function &node) {
 }
 
 void NameResolver::visit(ast::Function &node) {
-    _scopes.push(node.table());
+    _enter_function(node);
 
-    std::vector<std::shared_ptr<Variable>> parameters;
+    node.block()->accept(*this);
+    _table.exit_scope();
+}
+
+void NameResolver::_enter_function(ast::Function &node) {
+    _table.enter_scope();
+
+    std::vector<SymbolId> parameters;
     for (auto &parameter: node.parameters()) {
         parameter.accept(*this);
-
-        auto symbol = std::reinterpret_pointer_cast<Variable>(parameter.name().symbol());
-        parameters.push_back(symbol);
+        parameters.push_back(parameter.name().symbol());
     }
 
-    auto &function = std::get<Function>(*node.name().symbol());
+    auto &function = std::get<Function>(_symbols[node.name().symbol()]);
     function.set_parameters(std::move(parameters));
-
-    node.block()->accept(*this);
-    _scopes.pop();
 }
 
 void NameResolver::visit(ast::Parameter &node) {
@@ -59,20 +140,20 @@ void NameResolver::visit(ast::Parameter &node) {
 }
 
 void NameResolver::visit(ast::Block &node) {
-    _scopes.push(node.table());
+    _table.enter_scope();
     for (const auto &item: node.statements()) {
         item->accept(*this);
     }
-    _scopes.pop();
+    _table.exit_scope();
 }
 
 void NameResolver::visit(ast::Identifier &node) {
     if (node.kind() == ast::Identifier::Kind::Function) {
         const auto symbol = _check_existence<Function>(node.value());
-        node.set_symbol(symbol);
+        if (symbol) node.set_symbol(*symbol);
     } else if (node.kind() == ast::Identifier::Kind::Variable) {
         const auto symbol = _check_existence<Variable>(node.value());
-        node.set_symbol(symbol);
+        if (symbol) node.set_symbol(*symbol);
     } else {
         throw std::runtime_error("This kind of identifier is not yet implemented.");
     }
@@ -120,6 +201,12 @@ void NameResolver::visit(ast::Call &node) {
     }
 }
 
+void NameResolver::_report(Diagnostic::Code code, const front::Token &token) {
+    const Span span{token.offset(), static_cast<uint32_t>(token.contents().size())};
+    _diagnostics.report({code, span, {std::string(token.name().view())}});
+    _failed = true;
+}
+
 //==============================================================================
 // BSD 3-Clause License
 //
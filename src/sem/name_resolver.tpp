@@ -1,23 +1,17 @@
 template<typename Type, typename... Args>
-std::shared_ptr<Symbol> NameResolver::_check_non_existence(const front::Token &token, Args &&... args) {
-    try {
-        return _scopes.top()->insert<Type>(token.contents(), std::forward<Args>(args)...);
-    } catch (const IdentifierAlreadyTaken &error) {
-        std::cout << error.what() << std::endl;
-        _failed = true;
-        return nullptr;
-    }
+std::optional<SymbolId> NameResolver::_check_non_existence(const front::Token &token, Args &&... args) {
+    auto symbol = _table.insert<Type>(token.name(), std::forward<Args>(args)...);
+    if (!symbol) _report(Diagnostic::Code::IdentifierAlreadyTaken, token);
+
+    return symbol;
 }
 
 template<typename... Types>
-std::shared_ptr<Symbol> NameResolver::_check_existence(const front::Token &token) {
-    try {
-        return _scopes.top()->lookup<Types...>(token.contents());
-    } catch (const IdentifierNotFound &error) {
-        std::cout << error.what() << std::endl;
-        _failed = true;
-        return nullptr;
-    }
+std::optional<SymbolId> NameResolver::_check_existence(const front::Token &token) {
+    auto symbol = _table.lookup<Types...>(token.name());
+    if (!symbol) _report(Diagnostic::Code::IdentifierNotFound, token);
+
+    return symbol;
 }
 
 //==============================================================================
@@ -2,11 +2,17 @@
 
 using namespace arkoi::sem;
 
-std::ostream &operator<<(std::ostream &os, const std::shared_ptr<Symbol> &symbol) {
-    std::visit([&os](auto &value) { os << value.name(); }, *symbol);
+std::ostream &operator<<(std::ostream &os, const Symbol &symbol) {
+    std::visit([&os](auto &value) { os << value.name(); }, symbol);
     return os;
 }
 
+SymbolId SymbolArena::reserve(size_t count) {
+    const SymbolId first(static_cast<uint32_t>(_symbols.size()));
+    _symbols.insert(_symbols.end(), count, Variable(Name()));
+    return first;
+}
+
 //==============================================================================
 // BSD 3-Clause License
 //
@@ -0,0 +1,72 @@
+#include "sem/symbol_table.hpp"
+
+using namespace arkoi::sem;
+
+void SymbolTable::enter_scope() {
+    _watermarks.push_back(_declared.size());
+}
+
+void SymbolTable::exit_scope() {
+    const auto watermark = _watermarks.back();
+    _watermarks.pop_back();
+
+    while (_declared.size() > watermark) {
+        _shadows[_declared.back()].pop_back();
+        _declared.pop_back();
+    }
+}
+
+uint32_t SymbolTable::_index(const Name &name) {
+    if (!_globals) {
+        if (name.id() >= _shadows.size()) _shadows.resize(name.id() + 1);
+        return name.id();
+    }
+
+    const auto [entry, inserted] = _indices.try_emplace(name.id(), static_cast<uint32_t>(_shadows.size()));
+    if (inserted) _shadows.emplace_back();
+
+    return entry->second;
+}
+
+std::optional<uint32_t> SymbolTable::_find(const Name &name) const {
+    if (!_globals) {
+        if (name.id() < _shadows.size()) return name.id();
+        return std::nullopt;
+    }
+
+    const auto found = _indices.find(name.id());
+    if (found == _indices.end()) return std::nullopt;
+
+    return found->second;
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -1,23 +1,37 @@
 template<typename Type, typename... Args>
-std::shared_ptr<Symbol> &SymbolTable::insert(const std::string &name, Args &&... args) {
-    if (_symbols.contains(name)) throw IdentifierAlreadyTaken(name);
+std::optional<SymbolId> SymbolTable::insert(const Name &name, Args &&... args) {
+    const auto index = _index(name);
 
-    auto symbol = std::make_shared<Symbol>(Type(name, std::forward<Args>(args)...));
-    auto result = _symbols.emplace(name, symbol);
+    auto &shadows = _shadows[index];
+    if (!shadows.empty() && shadows.back().depth == depth()) return std::nullopt;
 
-    return result.first->second;
+    std::optional<SymbolId> symbol;
+    if (_slot) {
+        symbol = *_slot;
+        _symbols.make_at<Type>(*symbol, name, std::forward<Args>(args)...);
+        _slot = SymbolId(_slot->index() + 1);
+    } else {
+        symbol = _symbols.make<Type>(name, std::forward<Args>(args)...);
+    }
+
+    shadows.push_back({*symbol, depth()});
+    _declared.push_back(index);
+
+    return symbol;
 }
 
 template<typename... Types>
-[[nodiscard]] std::shared_ptr<Symbol> &SymbolTable::lookup(const std::string &name) {
-    auto found = _symbols.find(name);
-    if (found != _symbols.end() && (std::holds_alternative<Types>(*found->second) || ...)) {
-        return found->second;
+std::optional<SymbolId> SymbolTable::lookup(const Name &name) const {
+    if (const auto index = _find(name)) {
+        const auto &shadows = _shadows[*index];
+        for (auto entry = shadows.rbegin(); entry != shadows.rend(); ++entry) {
+            if ((std::holds_alternative<Types>(_symbols[entry->symbol]) || ...)) return entry->symbol;
+        }
     }
 
-    if (_parent == nullptr) throw IdentifierNotFound(name);
+    if (_globals) return _globals->lookup<Types...>(name);
 
-    return _parent->lookup<Types...>(name);
+    return std::nullopt;
 }
 
 //==============================================================================
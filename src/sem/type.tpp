@@ -0,0 +1,60 @@
+constexpr Type::Type(const Integral type)
+    : _id(static_cast<TypeId>(2 * std::countr_zero(std::to_underlying(type.size())) + type.sign())) {}
+
+constexpr Type::Type(const Floating type) : _id(type.size() == Size::DWORD ? TypeId::F32 : TypeId::F64) {}
+
+constexpr const Type::Info &Type::info() const {
+    return TYPE_INFOS[std::to_underlying(_id)];
+}
+
+template<typename Visitor>
+constexpr decltype(auto) Type::visit(Visitor &&visitor) const {
+    switch (kind()) {
+        case Kind::Integral: return std::forward<Visitor>(visitor)(Integral(size(), sign()));
+        case Kind::Floating: return std::forward<Visitor>(visitor)(Floating(size()));
+        case Kind::Boolean: return std::forward<Visitor>(visitor)(Boolean());
+    }
+
+    // As the -Wswitch flag is set, this will never be reached.
+    std::unreachable();
+}
+
+template<typename Visitor>
+constexpr decltype(auto) visit(Visitor &&visitor, const Type first, const Type second) {
+    return first.visit([&](const auto &first_view) -> decltype(auto) {
+        return second.visit([&](const auto &second_view) -> decltype(auto) {
+            return visitor(first_view, second_view);
+        });
+    });
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -1,5 +1,8 @@
 #include "sem/type_resolver.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <future>
 #include <limits>
 
 #include "ast/nodes.hpp"
@@ -8,52 +11,136 @@
 using namespace arkoi::sem;
 using namespace arkoi;
 
+static constexpr size_t BATCHES_PER_THREAD = 4;
+
 static constinit Integral BOOL_PROMOTED_INT_TYPE = {Size::DWORD, false};
 static constinit Boolean BOOL_TYPE = {};
 
-TypeResolver TypeResolver::resolve(ast::Program &node) {
-    TypeResolver resolver;
+TypeResolver TypeResolver::resolve(ast::Program &node, ast::AstArena &arena, SymbolArena &symbols,
+                                   DiagnosticEngine &diagnostics) {
+    TypeResolver resolver(arena, symbols, diagnostics);
 
     node.accept(resolver);
 
     return resolver;
 }
 
+TypeResolver TypeResolver::resolve(ast::Program &node, ast::AstArena &arena, SymbolArena &symbols,
+                                   DiagnosticEngine &diagnostics, ThreadPool &pool) {
+    struct ResolvedBatch {
+        DiagnosticEngine diagnostics;
+        bool failed;
+    };
+
+    TypeResolver resolver(arena, symbols, diagnostics);
+
+    for (const auto &statement: node.statements()) {
+        auto *function = ast::node_cast<ast::Function>(statement);
+        if (function) resolver.visit_as_prototype(*function);
+    }
+
+    // A few batches per thread balance out functions of different sizes, without paying for a task per function.
+    const auto statements = node.statements();
+    const auto batch_size = std::max<size_t>(1, statements.size() / (pool.size() * BATCHES_PER_THREAD));
+    const auto batch_count = (statements.size() + batch_size - 1) / batch_size;
+
+    // Every batch creates its implicit casts in an arena of its own, as the arenas are not synchronized.
+    std::deque<ast::AstArena> arenas(batch_count);
+
+    const auto limit = diagnostics.limit();
+
+    std::vector<std::future<ResolvedBatch>> resolved;
+    resolved.reserve(batch_count);
+    for (size_t index = 0; index < batch_count; index++) {
+        const auto start = index * batch_size;
+        const auto batch = statements.subspan(start, std::min(batch_size, statements.size() - start));
+
+        resolved.push_back(pool.submit([batch, &batch_arena = arenas[index], &symbols, limit] {
+            // The engines are not synchronized either, thus every batch reports to its own one.
+            DiagnosticEngine batch_diagnostics(limit);
+
+            TypeResolver batch_resolver(batch_arena, symbols, batch_diagnostics);
+            for (const auto &statement: batch) {
+                if (batch_diagnostics.is_full()) break;
+                statement->accept(batch_resolver);
+            }
+
+            return ResolvedBatch{std::move(batch_diagnostics), batch_resolver.has_failed()};
+        }));
+    }
+
+    // The tasks reference the arenas, thus all of them must be done before an exception may unwind.
+    for (const auto &future: resolved) future.wait();
+
+    for (size_t index = 0; index < batch_count; index++) {
+        auto batch = resolved[index].get();
+        diagnostics.absorb(std::move(batch.diagnostics));
+        resolver._failed |= batch.failed;
+
+        arena.absorb(std::move(arenas[index]));
+    }
+
+    return resolver;
+}
+
 void TypeResolver::visit(ast::Program &node) {
     for (const auto &statement: node.statements()) {
-        auto *function = dynamic_cast<ast::Function *>(statement.get());
+        auto *function = ast::node_cast<ast::Function>(statement);
         if (function) visit_as_prototype(*function);
     }
 
     for (const auto &statement: node.statements()) {
+        if (_diagnostics.is_full()) break;
         statement->accept(*this);
     }
 }
 
 void TypeResolver::visit_as_prototype(ast::Function &node) {
+    std::vector<Type> parameter_types;
     for (auto &parameter: node.parameters()) {
-        parameter.accept(*this);
+        // The fused resolver declares the parameter symbols only together with the body.
+        if (!_names) parameter.accept(*this);
+        parameter_types.push_back(parameter.type());
     }
 
-    auto &function = std::get<Function>(*node.name().symbol());
+    auto &function = std::get<Function>(_symbols[node.name().symbol()]);
+    function.set_parameter_types(std::move(parameter_types));
     function.set_return_type(node.type());
 }
 
 void TypeResolver::visit(ast::Function &node) {
-    const auto &function = std::get<Function>(*node.name().symbol());
+    if (_delegate(node)) return;
+
+    if (_names) {
+        _names->_enter_function(node);
+
+        for (auto &parameter: node.parameters()) {
+            parameter.accept(*this);
+        }
+    }
+
+    const auto &function = std::get<Function>(_symbols[node.name().symbol()]);
     _return_type = function.return_type();
 
     node.block()->accept(*this);
+
+    if (_names) _names->_table.exit_scope();
 }
 
 void TypeResolver::visit(ast::Block &node) {
+    if (_delegate(node)) return;
+
+    if (_names) _names->_table.enter_scope();
+
     for (const auto &statement: node.statements()) {
         statement->accept(*this);
     }
+
+    if (_names) _names->_table.exit_scope();
 }
 
 void TypeResolver::visit(ast::Parameter &node) {
-    auto &variable = std::get<Variable>(*node.name().symbol());
+    auto &variable = std::get<Variable>(_symbols[node.name().symbol()]);
     variable.set_type(node.type());
 }
 
@@ -67,14 +154,14 @@ void TypeResolver::visit(ast::Immediate &node) {
 }
 
 void TypeResolver::visit_integer(ast::Immediate &node) {
-    const auto &number_string = node.value().contents();
-    const auto sign = !number_string.starts_with('-');
+    const auto value = std::get<int64_t>(node.value().number());
+    const auto sign = !node.value().contents().starts_with('-');
 
     Size size;
     if (sign) {
-        size = std::stoll(number_string) > std::numeric_limits<int32_t>::max() ? Size::QWORD : Size::DWORD;
+        size = value > std::numeric_limits<int32_t>::max() ? Size::QWORD : Size::DWORD;
     } else {
-        size = std::stoull(number_string) > std::numeric_limits<uint32_t>::max() ? Size::QWORD : Size::DWORD;
+        size = static_cast<uint64_t>(value) > std::numeric_limits<uint32_t>::max() ? Size::QWORD : Size::DWORD;
     }
 
     node.set_type(Integral(size, sign));
@@ -82,9 +169,9 @@ void TypeResolver::visit_integer(ast::Immediate &node) {
 }
 
 void TypeResolver::visit_floating(ast::Immediate &node) {
-    const auto &number_string = node.value().contents();
+    const auto value = std::get<double>(node.value().number());
 
-    const auto size = std::stold(number_string) > std::numeric_limits<float>::max() ? Size::QWORD : Size::DWORD;
+    const auto size = value > std::numeric_limits<float>::max() ? Size::QWORD : Size::DWORD;
 
     node.set_type(Floating(size));
     _current_type = node.type();
@@ -96,7 +183,15 @@ void TypeResolver::visit_boolean(ast::Immediate &node) {
 }
 
 void TypeResolver::visit(ast::Variable &node) {
-    auto &variable = std::get<Variable>(*node.name().symbol());
+    if (_delegate(node)) return;
+
+    // The name is declared before the expression is resolved, exactly as the name resolver does it.
+    if (_names) {
+        std::ignore = _names->_check_non_existence<Variable>(node.name().value());
+        node.name().accept(*_names);
+    }
+
+    auto &variable = std::get<Variable>(_symbols[node.name().symbol()]);
     variable.set_type(node.type());
 
     node.expression()->accept(*this);
@@ -107,11 +202,11 @@ void TypeResolver::visit(ast::Variable &node) {
     }
 
     if (!_can_implicit_convert(type, node.type())) {
-        throw std::runtime_error("Variable has a wrong type.");
+        return _report(Diagnostic::Code::InvalidVariableType, _span(node.name().value()));
     }
 
     auto casted_expression = _cast(node.expression(), type, node.type());
-    node.set_expression(std::move(casted_expression));
+    node.set_expression(casted_expression);
 }
 
 void TypeResolver::visit(ast::Return &node) {
@@ -125,19 +220,29 @@ void TypeResolver::visit(ast::Return &node) {
     }
 
     if (!_can_implicit_convert(type, _return_type.value())) {
-        throw std::runtime_error("Return statement has a wrong return op.");
+        return _report(Diagnostic::Code::InvalidReturnType);
     }
 
     auto casted_expression = _cast(node.expression(), type, _return_type.value());
-    node.set_expression(std::move(casted_expression));
+    node.set_expression(casted_expression);
 }
 
 void TypeResolver::visit(ast::Identifier &node) {
+    if (_delegate(node)) return;
+
+    if (_names) {
+        node.accept(*_names);
+        if (_names->has_failed()) {
+            _current_type = BOOL_TYPE;
+            return;
+        }
+    }
+
     if(node.kind() == ast::Identifier::Kind::Function) {
-        const auto &function = std::get<Function>(*node.symbol());
+        const auto &function = std::get<Function>(_symbols[node.symbol()]);
         _current_type = function.return_type();
     } else if(node.kind() == ast::Identifier::Kind::Variable) {
-        const auto &variable = std::get<Variable>(*node.symbol());
+        const auto &variable = std::get<Variable>(_symbols[node.symbol()]);
         _current_type = variable.type();
     } else {
         throw std::runtime_error("This kind of identifier is not yet implemented.");
@@ -158,12 +263,12 @@ void TypeResolver::visit(ast::Binary &node) {
 
     if (left != op_type) {
         auto casted_left = _cast(node.left(), left, op_type);
-        node.set_left(std::move(casted_left));
+        node.set_left(casted_left);
     }
 
     if (right != op_type) {
         auto casted_right = _cast(node.right(), right, op_type);
-        node.set_right(std::move(casted_right));
+        node.set_right(casted_right);
     }
 
     switch (node.op()) {
@@ -191,7 +296,7 @@ void TypeResolver::visit(ast::Cast &node) {
     node.set_from(from);
 
     if (!_can_implicit_convert(from, node.to())) {
-        throw std::runtime_error("This cast is not valid.");
+        _report(Diagnostic::Code::InvalidCast);
     }
 
     _current_type = node.to();
@@ -205,40 +310,61 @@ void TypeResolver::visit(ast::Assign &node) {
     const auto type = _current_type.value();
 
     if (!_can_implicit_convert(type, identifier_type)) {
-        throw std::runtime_error("Assign source has a wrong type.");
+        return _report(Diagnostic::Code::InvalidAssignType, _span(node.name().value()));
     }
 
     if (type != identifier_type) {
         auto casted_expression = _cast(node.expression(), type, identifier_type);
-        node.set_expression(std::move(casted_expression));
+        node.set_expression(casted_expression);
     }
 }
 
 void TypeResolver::visit(ast::Call &node) {
     node.name().accept(*this);
 
-    const auto &function = std::get<Function>(*node.name().symbol());
+    // The arguments of an unresolved function still need their names resolved.
+    if (_names && _names->has_failed()) {
+        for (const auto &argument: node.arguments()) {
+            argument->accept(*this);
+        }
 
-    if (function.parameters().size() != node.arguments().size()) {
-        throw std::runtime_error("The argument count doesn't equal to the parameters count.");
+        return;
+    }
+
+    const auto &function = std::get<Function>(_symbols[node.name().symbol()]);
+    const auto &parameter_types = function.parameter_types();
+
+    if (parameter_types.size() != node.arguments().size()) {
+        _report(Diagnostic::Code::ArgumentCountMismatch, _span(node.name().value()));
+        _current_type = function.return_type();
+
+        // The arguments aren't type checked anymore, but the fused resolver still has to resolve their names.
+        if (_names) {
+            for (const auto &argument: node.arguments()) {
+                argument->accept(*_names);
+            }
+        }
+
+        return;
     }
 
     for (size_t index = 0; index < node.arguments().size(); index++) {
-        const auto &variable = function.parameters()[index];
+        const auto &parameter_type = parameter_types[index];
 
         auto &argument = node.arguments()[index];
         argument->accept(*this);
         auto type = _current_type.value();
 
-        if (type == variable->type()) continue;
+        if (type == parameter_type) continue;
 
-        if (!_can_implicit_convert(type, variable->type())) {
-            throw std::runtime_error("The arguments type doesn't match the parameters one.");
+        if (!_can_implicit_convert(type, parameter_type)) {
+            _report(Diagnostic::Code::InvalidArgumentType, _span(node.name().value()));
+            continue;
         }
 
         // Replace the argument with its implicit conversion.
-        auto casted_argument = _cast(argument, type, variable->type());
-        node.arguments()[index] = std::move(casted_argument);
+        auto casted_argument = _cast(argument, type, parameter_type);
+        node.arguments()[index] = casted_argument;
     }
 
     _current_type = function.return_type();
@@ -250,12 +376,10 @@ void TypeResolver::visit(ast::If &node) {
     const auto type = _current_type.value();
 
     if (!_can_implicit_convert(type, BOOL_TYPE)) {
-        throw std::runtime_error("Return statement has a wrong return op.");
-    }
-
-    if (!std::holds_alternative<Boolean>(type)) {
+        _report(Diagnostic::Code::InvalidConditionType);
+    } else if (!type.is_boolean()) {
         auto casted_condition = _cast(node.condition(), type, BOOL_TYPE);
-        node.set_condition(std::move(casted_condition));
+        node.set_condition(casted_condition);
     }
 
     node.branch()->accept(*this);
@@ -265,8 +389,8 @@ void TypeResolver::visit(ast::If &node) {
 
 // https://en.cppreference.com/w/cpp/language/usual_arithmetic_conversions
 Type TypeResolver::_arithmetic_conversion(const Type &left_type, const Type &right_type) {
-    const auto *floating_left = std::get_if<Floating>(&left_type);
-    const auto *floating_right = std::get_if<Floating>(&right_type);
+    const auto floating_left = left_type.is_floating();
+    const auto floating_right = right_type.is_floating();
 
     // Stage 4: If either operand is of floating-point type, the following rules are applied:
     if (floating_left || floating_right) {
@@ -281,21 +405,23 @@ Type TypeResolver::_arithmetic_conversion(const Type &left_type, const Type &rig
         // Otherwise, if the floating-point conversion ranks of the types of the operands are ordered but(since C++23)
         // not equal, then the operand of the mid with the lesser floating-point conversion rank is converted to the
         // mid of the other operand.
-        if (floating_left->size() > floating_right->size()) return left_type;
-        if (floating_right->size() > floating_left->size()) return right_type;
+        if (left_type.size() > right_type.size()) return left_type;
+        if (right_type.size() > left_type.size()) return right_type;
     }
 
     // Stage 5: Both operands are converted to a common op C.
-    auto t1 = std::visit(match{
+    auto t1 = left_type.visit(match{
         [](const Integral &type) -> Integral { return type; },
         [](const Boolean &) -> Integral { return BOOL_PROMOTED_INT_TYPE; },
-        [](const auto &) -> Integral { throw std::runtime_error("The left type must be of integral type."); }
-    }, left_type);
-    auto t2 = std::visit(match{
+        // Floating operands were already handled by stage 4.
+        [](const Floating &) -> Integral { std::unreachable(); }
+    });
+    auto t2 = right_type.visit(match{
         [](const Integral &type) -> Integral { return type; },
         [](const Boolean &) -> Integral { return BOOL_PROMOTED_INT_TYPE; },
-        [](const auto &) -> Integral { throw std::runtime_error("The left type must be of integral type."); }
-    }, right_type);
+        // Floating operands were already handled by stage 4.
+        [](const Floating &) -> Integral { std::unreachable(); }
+    });
 
     // Given the types T1 and T2 as the promoted op (under the rules of integral promotions) of the operands, the
     // following rules are applied to determine C:
@@ -329,7 +455,7 @@ Type TypeResolver::_arithmetic_conversion(const Type &left_type, const Type &rig
 
 // https://en.cppreference.com/w/cpp/language/implicit_conversion
 bool TypeResolver::_can_implicit_convert(const Type &from, const Type &destination) {
-    return std::visit(match{
+    return sem::visit(match{
         // A prvalue of an integer mid or of an unscoped enumeration op can be converted to any other integer mid.
         // If the conversion is listed under integral promotions, it is a promotion and not a conversion.
         [](const Integral &, const Integral &) { return true; },
@@ -357,8 +483,28 @@ bool TypeResolver::_can_implicit_convert(const Type &from, const Type &destinati
     }, from, destination);
 }
 
-std::unique_ptr<ast::Node> TypeResolver::_cast(std::unique_ptr<ast::Node> &node, const Type &from, const Type &to) {
-    return std::make_unique<ast::Cast>(std::move(node), from, to);
+ast::Node *TypeResolver::_cast(ast::Node *node, const Type &from, const Type &to) {
+    return _arena.make<ast::Cast>(node, from, to);
+}
+
+void TypeResolver::_report(Diagnostic::Code code, std::optional<Span> span) {
+    _diagnostics.report({code, span});
+    _failed = true;
+}
+
+Span TypeResolver::_span(const front::Token &token) {
+    return {token.offset(), static_cast<uint32_t>(token.contents().size())};
+}
+
+bool TypeResolver::_delegate(ast::Node &node) {
+    if (!_names || !_names->has_failed()) return false;
+
+    node.accept(*_names);
+
+    // The parent nodes still read a type, even though it won't be used anymore.
+    _current_type = BOOL_TYPE;
+
+    return true;
 }
 
 //==============================================================================
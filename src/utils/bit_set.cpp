@@ -0,0 +1,187 @@
+#include "utils/bit_set.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+static constexpr uint64_t bit(size_t index) {
+    return uint64_t{1} << (index % 64);
+}
+
+void BitSet::set(size_t index) {
+    assert(index < _size);
+    _words[index / 64] |= bit(index);
+}
+
+void BitSet::reset(size_t index) {
+    assert(index < _size);
+    _words[index / 64] &= ~bit(index);
+}
+
+bool BitSet::test(size_t index) const {
+    assert(index < _size);
+    return (_words[index / 64] & bit(index)) != 0;
+}
+
+BitSet &BitSet::operator|=(const BitSet &other) {
+    assert(_size == other._size);
+    for (size_t position = 0; position < _words.size(); position++) _words[position] |= other._words[position];
+    return *this;
+}
+
+BitSet &BitSet::operator&=(const BitSet &other) {
+    assert(_size == other._size);
+    for (size_t position = 0; position < _words.size(); position++) _words[position] &= other._words[position];
+    return *this;
+}
+
+BitSet &BitSet::operator-=(const BitSet &other) {
+    assert(_size == other._size);
+    for (size_t position = 0; position < _words.size(); position++) _words[position] &= ~other._words[position];
+    return *this;
+}
+
+size_t BitSet::count() const {
+    size_t count = 0;
+    for (const auto word: _words) count += static_cast<size_t>(std::popcount(word));
+    return count;
+}
+
+bool BitSet::empty() const {
+    return std::ranges::all_of(_words, [](const auto word) { return word == 0; });
+}
+
+static auto find_word(auto &words, size_t position) {
+    return std::ranges::lower_bound(words, position, {}, [](const auto &word) { return word.first; });
+}
+
+void SparseBitSet::set(size_t index) {
+    assert(index < _size);
+
+    const auto found = find_word(_words, index / 64);
+    if (found != _words.end() && found->first == index / 64) {
+        found->second |= bit(index);
+    } else {
+        _words.emplace(found, index / 64, bit(index));
+    }
+}
+
+void SparseBitSet::reset(size_t index) {
+    assert(index < _size);
+
+    const auto found = find_word(_words, index / 64);
+    if (found == _words.end() || found->first != index / 64) return;
+
+    found->second &= ~bit(index);
+    if (found->second == 0) _words.erase(found);
+}
+
+bool SparseBitSet::test(size_t index) const {
+    assert(index < _size);
+
+    const auto found = find_word(_words, index / 64);
+    return found != _words.end() && found->first == index / 64 && (found->second & bit(index)) != 0;
+}
+
+SparseBitSet &SparseBitSet::operator|=(const SparseBitSet &other) {
+    assert(_size == other._size);
+    if (other._words.empty()) return *this;
+
+    std::vector<std::pair<size_t, uint64_t>> words;
+    words.reserve(_words.size() + other._words.size());
+
+    auto left = _words.cbegin();
+    auto right = other._words.cbegin();
+    while (left != _words.cend() && right != other._words.cend()) {
+        if (left->first < right->first) {
+            words.push_back(*left++);
+        } else if (right->first < left->first) {
+            words.push_back(*right++);
+        } else {
+            words.emplace_back(left->first, left->second | right->second);
+            left++, right++;
+        }
+    }
+
+    words.insert(words.end(), left, _words.cend());
+    words.insert(words.end(), right, other._words.cend());
+
+    _words = std::move(words);
+    return *this;
+}
+
+SparseBitSet &SparseBitSet::operator&=(const SparseBitSet &other) {
+    assert(_size == other._size);
+
+    // The words are compacted in place, as the result is never longer than this set.
+    size_t kept = 0;
+    auto right = other._words.cbegin();
+    for (size_t left = 0; left < _words.size() && right != other._words.cend();) {
+        if (_words[left].first < right->first) {
+            left++;
+        } else if (right->first < _words[left].first) {
+            right++;
+        } else {
+            const auto word = _words[left].second & right->second;
+            if (word != 0) _words[kept++] = {_words[left].first, word};
+            left++, right++;
+        }
+    }
+
+    _words.resize(kept);
+    return *this;
+}
+
+SparseBitSet &SparseBitSet::operator-=(const SparseBitSet &other) {
+    assert(_size == other._size);
+
+    size_t kept = 0;
+    auto right = other._words.cbegin();
+    for (size_t left = 0; left < _words.size(); left++) {
+        while (right != other._words.cend() && right->first < _words[left].first) right++;
+
+        auto word = _words[left].second;
+        if (right != other._words.cend() && right->first == _words[left].first) word &= ~right->second;
+
+        if (word != 0) _words[kept++] = {_words[left].first, word};
+    }
+
+    _words.resize(kept);
+    return *this;
+}
+
+size_t SparseBitSet::count() const {
+    size_t count = 0;
+    for (const auto &[_, word]: _words) count += static_cast<size_t>(std::popcount(word));
+    return count;
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
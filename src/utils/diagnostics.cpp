@@ -0,0 +1,85 @@
+#include "utils/diagnostics.hpp"
+
+#include <utility>
+
+std::string Diagnostic::message() const {
+    switch (_code) {
+        case Code::UnexpectedEndOfLine: return "Unexpectedly reached the End Of Line";
+        case Code::UnexpectedChar: return "Expected " + _args[0] + " but got " + _args[1];
+        case Code::UnknownChar: return "Didn't expect " + _args[0];
+        case Code::NumberOutOfRange: return "The number " + _args[0] + " exceeds the 64bit limitations.";
+        case Code::Misindentation: return "Leading spaces are not of a multiple of 4";
+        case Code::UnexpectedEndOfTokens: return "Unexpectedly reached the End Of Tokens";
+        case Code::UnexpectedToken: return "Expected " + _args[0] + " but got " + _args[1];
+        case Code::IdentifierAlreadyTaken: return "The identifier " + _args[0] + " is already taken.";
+        case Code::IdentifierNotFound: return "The identifier " + _args[0] + " was not found.";
+        case Code::InvalidVariableType: return "Variable has a wrong type.";
+        case Code::InvalidReturnType: return "Return statement has a wrong return type.";
+        case Code::InvalidCast: return "This cast is not valid.";
+        case Code::InvalidAssignType: return "Assign source has a wrong type.";
+        case Code::ArgumentCountMismatch: return "The argument count doesn't equal to the parameters count.";
+        case Code::InvalidArgumentType: return "The arguments type doesn't match the parameters one.";
+        case Code::InvalidConditionType: return "The condition can't be converted to bool.";
+    }
+
+    // As the -Wswitch flag is set, this will never be reached.
+    std::unreachable();
+}
+
+void DiagnosticEngine::report(Diagnostic diagnostic) {
+    if (is_full()) return;
+
+    _diagnostics.push_back(std::move(diagnostic));
+}
+
+void DiagnosticEngine::absorb(DiagnosticEngine &&other) {
+    for (auto &diagnostic: other._diagnostics) report(std::move(diagnostic));
+
+    other._diagnostics.clear();
+}
+
+void DiagnosticEngine::render(std::ostream &os, const LineTable &lines) const {
+    for (const auto &diagnostic: _diagnostics) {
+        if (const auto &span = diagnostic.span()) {
+            const auto [row, column] = lines.locate(span->offset);
+            os << (row + 1) << ":" << (column + 1) << ": ";
+        }
+
+        os << diagnostic.message() << std::endl;
+    }
+}
+
+bool DiagnosticEngine::is_full() const {
+    return _limit != 0 && _diagnostics.size() >= _limit;
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,78 @@
+#include "utils/string_interner.hpp"
+
+#include <mutex>
+#include <tuple>
+
+StringInterner::StringInterner() {
+    std::ignore = intern("");
+}
+
+uint32_t StringInterner::intern(std::string_view value) {
+    {
+        std::shared_lock lock(_mutex);
+        const auto found = _ids.find(value);
+        if (found != _ids.end()) return found->second;
+    }
+
+    std::unique_lock lock(_mutex);
+
+    // Another thread might have interned the same string between both locks.
+    const auto found = _ids.find(value);
+    if (found != _ids.end()) return found->second;
+
+    const auto id = static_cast<uint32_t>(_strings.size());
+    const auto &stored = _strings.emplace_back(value);
+    _ids.emplace(stored, id);
+
+    return id;
+}
+
+std::string_view StringInterner::lookup(uint32_t id) const {
+    std::shared_lock lock(_mutex);
+    return _strings.at(id);
+}
+
+size_t StringInterner::size() const {
+    std::shared_lock lock(_mutex);
+    return _strings.size();
+}
+
+StringInterner &StringInterner::global() {
+    static StringInterner interner;
+    return interner;
+}
+
+std::ostream &operator<<(std::ostream &os, const Name &name) {
+    return os << name.view();
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
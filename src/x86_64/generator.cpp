@@ -7,10 +7,18 @@
 using namespace arkoi::x86_64;
 using namespace arkoi;
 
-Generator::Generator(il::Module &module) : _module(module) {
+Generator::Generator(il::Module &module) {
     module.accept(*this);
 }
 
+Generator::Generator() {
+    _prologue();
+}
+
+void Generator::generate(il::Function &function) {
+    function.accept(*this);
+}
+
 std::stringstream Generator::output() const {
     std::stringstream output;
 
@@ -20,7 +28,33 @@ std::stringstream Generator::output() const {
     return output;
 }
 
+std::stringstream Generator::take_text() {
+    std::stringstream output;
+
+    for (const auto &item: this->_text) output << item << "\n";
+    _text.clear();
+
+    return output;
+}
+
+std::stringstream Generator::take_data() {
+    std::stringstream output;
+
+    for (const auto &item: this->_data) output << item << "\n";
+    _data.clear();
+
+    return output;
+}
+
 void Generator::visit(il::Module &module) {
+    _prologue();
+
+    for (auto &function: module) {
+        function.accept(*this);
+    }
+}
+
+void Generator::_prologue() {
     _directive(".section .data", _data);
 
     _directive(".intel_syntax noprefix", _text);
@@ -34,16 +68,12 @@ void Generator::visit(il::Module &module) {
     _mov(RAX, 60);
     _syscall();
     _newline(_text);
-
-    for (auto &function: module) {
-        function.accept(*this);
-    }
 }
 
 void Generator::visit(il::Function &function) {
     _current_mapper = std::make_unique<Mapper>(function);
 
-    _label(function.name());
+    _label(function.name().view());
 
     for (auto &block: function) {
         block.accept(*this);
@@ -59,7 +89,7 @@ void Generator::visit(il::BasicBlock &block) {
         if (!_current_mapper->function().is_leaf() || stack_size > 128) _enter(stack_size, 0);
     } else {
         // Just a normal block.
-        _label(block.label());
+        _label(block.label().view());
     }
 
     for (auto &instruction: block) {
@@ -99,7 +129,7 @@ void Generator::visit(il::Binary &instruction) {
 }
 
 void Generator::_add(const Operand &result, Operand left, const Operand &right, const sem::Type &type) {
-    if (std::holds_alternative<sem::Floating>(type)) {
+    if (type.is_floating()) {
         // As there are no direct floating immediates (they will always be replaced with memory operands, see _load),
         // we just need to adjust the lhs to a register, which we always do.
         // Thus left:right will always be reg:mem or reg:reg, which is a valid operand encoding.
@@ -124,7 +154,7 @@ void Generator::_add(const Operand &result, Operand left, const Operand &right,
 }
 
 void Generator::_sub(const Operand &result, Operand left, const Operand &right, const sem::Type &type) {
-    if (std::holds_alternative<sem::Floating>(type)) {
+    if (type.is_floating()) {
         // As there are no direct floating immediates (they will always be replaced with memory operands, see _load),
         // we just need to adjust the lhs to a register, which we always do.
         // Thus left:right will always be reg:mem or reg:reg, which is a valid operand encoding.
@@ -149,7 +179,7 @@ void Generator::_sub(const Operand &result, Operand left, const Operand &right,
 }
 
 void Generator::_mul(const Operand &result, Operand left, const Operand &right, const sem::Type &type) {
-    if (std::holds_alternative<sem::Floating>(type)) {
+    if (type.is_floating()) {
         // As there are no direct floating immediates (they will always be replaced with memory operands, see _load),
         // we just need to adjust the lhs to a register, which we always do.
         // Thus left:right will always be reg:mem or reg:reg, which is a valid operand encoding.
@@ -176,7 +206,7 @@ void Generator::_mul(const Operand &result, Operand left, const Operand &right,
 }
 
 void Generator::_div(const Operand &result, Operand left, Operand right, const sem::Type &type) {
-    if (std::holds_alternative<sem::Floating>(type)) {
+    if (type.is_floating()) {
         // As there are no direct floating immediates (they will always be replaced with memory operands, see _load),
         // we just need to adjust the lhs to a register, which we always do.
         // Thus left:right will always be reg:mem or reg:reg, which is a valid operand encoding.
@@ -199,8 +229,7 @@ void Generator::_div(const Operand &result, Operand left, Operand right, const s
         }
 
         // Depending on the signess of the integral value, we need to choose idiv or div.
-        auto *integral = std::get_if<sem::Integral>(&type);
-        const auto &instruction = (integral && integral->sign()) ? &Generator::_idiv : &Generator::_udiv;
+        const auto &instruction = type.sign() ? &Generator::_idiv : &Generator::_udiv;
         (this->*instruction)(right);
 
         _store(a_reg, result, type);
@@ -208,7 +237,7 @@ void Generator::_div(const Operand &result, Operand left, Operand right, const s
 }
 
 void Generator::_gth(const Operand &result, Operand left, const Operand &right, const sem::Type &type) {
-    if (std::holds_alternative<sem::Floating>(type)) {
+    if (type.is_floating()) {
         // As there are no direct floating immediates (they will always be replaced with memory operands, see _load),
         // we just need to adjust the lhs to a register, which we always do.
         // Thus left:right will always be reg:mem or reg:reg, which is a valid operand encoding.
@@ -225,15 +254,13 @@ void Generator::_gth(const Operand &result, Operand left, const Operand &right,
         left = _adjust_to_reg(result, left, type);
 
         _cmp(left, right);
-
-        const auto *integral = std::get_if<sem::Integral>(&type);
-        const auto &instruction = (integral && integral->sign()) ? &Generator::_setg : &Generator::_seta;
+        const auto &instruction = type.sign() ? &Generator::_setg : &Generator::_seta;
         (this->*instruction)(result);
     }
 }
 
 void Generator::_lth(const Operand &result, Operand left, const Operand &right, const sem::Type &type) {
-    if (std::holds_alternative<sem::Floating>(type)) {
+    if (type.is_floating()) {
         // As there are no direct floating immediates (they will always be replaced with memory operands, see _load),
         // we just need to adjust the lhs to a register, which we always do.
         // Thus left:right will always be reg:mem or reg:reg, which is a valid operand encoding.
@@ -250,9 +277,7 @@ void Generator::_lth(const Operand &result, Operand left, const Operand &right,
         left = _adjust_to_reg(result, left, type);
 
         _cmp(left, right);
-
-        const auto *integral = std::get_if<sem::Integral>(&type);
-        const auto &instruction = (integral && integral->sign()) ? &Generator::_setl : &Generator::_setb;
+        const auto &instruction = type.sign() ? &Generator::_setl : &Generator::_setb;
         (this->*instruction)(result);
     }
 }
@@ -261,7 +286,7 @@ void Generator::visit(il::Cast &instruction) {
     const auto result = _load(instruction.result());
     const auto source = _load(instruction.source());
 
-    std::visit(match{
+    sem::visit(match{
         [&](const sem::Floating &from, const sem::Floating &to) { _float_to_float(result, source, from, to); },
         [&](const sem::Floating &from, const sem::Integral &to) { _float_to_int(result, source, from, to); },
         [&](const sem::Floating &from, const sem::Boolean &to) { _float_to_bool(result, source, from, to); },
@@ -506,7 +531,7 @@ void Generator::visit(il::Call &instruction) {
 
     const auto stack_size = _generate_arguments(instruction.arguments());
 
-    _call(instruction.name());
+    _call(instruction.name().view());
 
     // We need to clean up the stack if there were some stack arguments.
     if (stack_size != 0) _add(RSP, stack_size);
@@ -523,9 +548,9 @@ size_t Generator::_generate_arguments(const std::vector<il::Operand> &arguments)
     for (auto &argument: arguments) {
         const auto &type = argument.type();
 
-        if (std::holds_alternative<sem::Integral>(type) || std::holds_alternative<sem::Boolean>(type)) {
+        if (type.register_class() == sem::RegisterClass::General) {
             if (integer++ < INTEGER_ARGUMENT_REGISTERS.size()) continue;
-        } else if (std::holds_alternative<sem::Floating>(type)) {
+        } else if (type.register_class() == sem::RegisterClass::Floating) {
             if (floating++ < SSE_ARGUMENT_REGISTERS.size()) continue;
         }
 
@@ -546,14 +571,14 @@ size_t Generator::_generate_arguments(const std::vector<il::Operand> &arguments)
         const auto &type = argument.type();
         const auto source = _load(argument);
 
-        if (std::holds_alternative<sem::Integral>(type) || std::holds_alternative<sem::Boolean>(type)) {
+        if (type.register_class() == sem::RegisterClass::General) {
             if (integer < INTEGER_ARGUMENT_REGISTERS.size()) {
                 auto destination = Register(INTEGER_ARGUMENT_REGISTERS[integer], type.size());
                 _store(source, destination, type);
                 integer++;
                 continue;
             }
-        } else if (std::holds_alternative<sem::Floating>(type)) {
+        } else if (type.register_class() == sem::RegisterClass::Floating) {
             if (floating < SSE_ARGUMENT_REGISTERS.size()) {
                 auto destination = Register(SSE_ARGUMENT_REGISTERS[floating], type.size());
                 _store(source, destination, type);
@@ -581,12 +606,12 @@ void Generator::visit(il::If &instruction) {
     }
 
     _test(condition, condition);
-    _jnz(instruction.branch());
-    _jmp(instruction.next());
+    _jnz(instruction.branch().view());
+    _jmp(instruction.next().view());
 }
 
 void Generator::visit(il::Goto &instruction) {
-    _jmp(instruction.label());
+    _jmp(instruction.label().view());
 }
 
 void Generator::visit(il::Store &instruction) {
@@ -648,7 +673,7 @@ void Generator::_store(Operand source, const Operand &destination, const sem::Ty
         source = _store_temp_1(source, type);
     }
 
-    if (std::holds_alternative<sem::Floating>(type)) {
+    if (type.is_floating()) {
         const auto &instruction = (type.size() == Size::QWORD) ? &Generator::_movsd : &Generator::_movss;
         (this->*instruction)(destination, source);
     } else {
@@ -663,8 +688,8 @@ Register Generator::_store_temp_1(const Operand &source, const sem::Type &type)
 }
 
 Register Generator::_temp_1_register(const sem::Type &type) {
-    auto reg_base = (std::holds_alternative<sem::Floating>(type) ? Register::Base::XMM10 : Register::Base::R10);
-    return {reg_base, type.size()};
+    const auto floating = (type.register_class() == sem::RegisterClass::Floating);
+    return {floating ? Register::Base::XMM10 : Register::Base::R10, type.size()};
 }
 
 Register Generator::_store_temp_2(const Operand &source, const sem::Type &type) {
@@ -674,8 +699,8 @@ Register Generator::_store_temp_2(const Operand &source, const sem::Type &type)
 }
 
 Register Generator::_temp_2_register(const sem::Type &type) {
-    auto reg_base = (std::holds_alternative<sem::Floating>(type) ? Register::Base::XMM11 : Register::Base::R11);
-    return {reg_base, type.size()};
+    const auto floating = (type.register_class() == sem::RegisterClass::Floating);
+    return {floating ? Register::Base::XMM11 : Register::Base::R11, type.size()};
 }
 
 Register Generator::_adjust_to_reg(const Operand &, const Operand &target, const sem::Type &type) {
@@ -690,20 +715,20 @@ void Generator::_directive(const std::string &directive, std::vector<AssemblyIte
     output.push_back(Directive(directive));
 }
 
-void Generator::_label(const std::string &name) {
-    _text.push_back(Label(name));
+void Generator::_label(std::string_view name) {
+    _text.push_back(Label(std::string(name)));
 }
 
-void Generator::_jmp(const std::string &name) {
-    _text.push_back(Instruction(Instruction::Opcode::JMP, {name}));
+void Generator::_jmp(std::string_view name) {
+    _text.push_back(Instruction(Instruction::Opcode::JMP, {std::string(name)}));
 }
 
-void Generator::_jnz(const std::string &name) {
-    _text.push_back(Instruction(Instruction::Opcode::JNZ, {name}));
+void Generator::_jnz(std::string_view name) {
+    _text.push_back(Instruction(Instruction::Opcode::JNZ, {std::string(name)}));
 }
 
-void Generator::_call(const std::string &name) {
-    _text.push_back(Instruction(Instruction::Opcode::CALL, {name}));
+void Generator::_call(std::string_view name) {
+    _text.push_back(Instruction(Instruction::Opcode::CALL, {std::string(name)}));
 }
 
 void Generator::_movsxd(const Operand &destination, const Operand &source) {
@@ -75,14 +75,14 @@ void Mapper::_map_parameters(const std::vector<il::Variable> &parameters, bool u
     for (auto &parameter: parameters) {
         const auto &type = parameter.type();
 
-        if (std::holds_alternative<sem::Integral>(type) || std::holds_alternative<sem::Boolean>(type)) {
+        if (type.register_class() == sem::RegisterClass::General) {
             if (integer < INTEGER_ARGUMENT_REGISTERS.size()) {
                 auto reg = Register(INTEGER_ARGUMENT_REGISTERS[integer], type.size());
                 _add_register(parameter, reg);
                 integer++;
                 continue;
             }
-        } else if (std::holds_alternative<sem::Floating>(type)) {
+        } else if (type.register_class() == sem::RegisterClass::Floating) {
             if (floating < SSE_ARGUMENT_REGISTERS.size()) {
                 auto reg = Register(SSE_ARGUMENT_REGISTERS[floating], type.size());
                 _add_register(parameter, reg);
@@ -163,17 +163,13 @@ size_t Mapper::stack_size() const {
 }
 
 Register Mapper::return_register(const sem::Type &target) {
-    return std::visit(match{
-        [&](const sem::Integral &type) -> Register {
-            return {Register::Base::A, type.size()};
-        },
-        [&](const sem::Floating &type) -> Register {
-            return {Register::Base::XMM0, type.size()};
-        },
-        [&](const sem::Boolean &) -> Register {
-            return {Register::Base::A, Size::BYTE};
-        }
-    }, target);
+    switch (target.register_class()) {
+        case sem::RegisterClass::General: return {Register::Base::A, target.size()};
+        case sem::RegisterClass::Floating: return {Register::Base::XMM0, target.size()};
+    }
+
+    // As the -Wswitch flag is set, this will never be reached.
+    std::unreachable();
 }
 
 size_t Mapper::align_size(size_t input) {
@@ -1,5 +1,6 @@
 #include "x86_64/register_allocation.hpp"
 
+#include <algorithm>
 #include <ranges>
 #include <array>
 
@@ -15,39 +16,53 @@ static constexpr std::array FLOATING_REGISTERS{
     Register::Base::XMM14, Register::Base::XMM15,
 };
 
+// Above this many operands a dense set per block gets too large, thus the liveness uses sparse sets instead.
+static constexpr size_t SPARSE_OPERANDS = 4096;
+
 RegisterAllocater::RegisterAllocater(il::Function &function, Mapping precolored)
-    : _function(function), _assigned(std::move(precolored)) {
-    _renumber();
-    _build();
-    _simplify();
-}
+    : _function(function), _operands(function), _assigned(std::move(precolored)) {
+    if (_operands.size() > SPARSE_OPERANDS) {
+        _build<SparseBitSet>();
+    } else {
+        _build<BitSet>();
+    }
 
-void RegisterAllocater::_renumber() {
-    _analysis = il::DataflowAnalysis<il::InstructionLivenessAnalysis>();
-    _analysis.run(_function);
+    _simplify();
 }
 
+template<typename Set>
 void RegisterAllocater::_build() {
+    // Only the liveness at the block boundaries is kept, the one of each instruction is replayed from it.
+    il::DataflowAnalysis<il::BlockLivenessAnalysis<Set>> analysis(_operands);
+    analysis.run(_function);
+
     _graph = InterferenceGraph<il::Variable>();
 
-    for (const auto &in_operands: std::views::values(_analysis.in())) {
-        for (const auto &operand: in_operands) {
-            const auto *op_variable = std::get_if<il::Variable>(&operand);
-            if (!op_variable) continue;
+    const auto add_nodes = [&](const Set &operands) {
+        operands.for_each([&](size_t index) {
+            const auto *op_variable = std::get_if<il::Variable>(&_operands[index]);
+            if (!op_variable) return;
             _graph.add_node(*op_variable);
-        }
-    }
+        });
+    };
+
+    for (auto &block: _function) {
+        add_nodes(analysis.in().at(&block));
 
-    for (const auto &[instruction, out_operands]: _analysis.out()) {
-        for (const auto &definition: instruction->defs()) {
-            const auto *def_variable = std::get_if<il::Variable>(&definition);
-            if (!def_variable) continue;
+        il::LivenessReplay<Set> replay(block, analysis.out().at(&block), _operands);
+        for (const auto &[instruction, out_operands]: replay) {
+            add_nodes(out_operands);
 
-            for (const auto &operand: out_operands) {
-                const auto *op_variable = std::get_if<il::Variable>(&operand);
-                if (!op_variable) continue;
+            for (const auto &definition: instruction.defs()) {
+                const auto *def_variable = std::get_if<il::Variable>(&definition);
+                if (!def_variable) continue;
 
-                _graph.add_edge(*def_variable, *op_variable);
+                out_operands.for_each([&](size_t index) {
+                    const auto *op_variable = std::get_if<il::Variable>(&_operands[index]);
+                    if (!op_variable) return;
+
+                    _graph.add_edge(*def_variable, *op_variable);
+                });
             }
         }
     }
@@ -64,26 +79,21 @@ void RegisterAllocater::_simplify() {
     }
 
     while (!work_list.empty()) {
-        auto found = false;
-
-        for (const auto &node: work_list) {
+        const auto simplifiable = std::ranges::find_if(work_list, [&](const il::Variable &node) {
             const auto interferences = _graph.interferences(node);
 
-            const auto is_floating = std::holds_alternative<sem::Floating>(node.type());
-            if (is_floating && interferences.size() >= FLOATING_REGISTERS.size()) continue;
-            if (!is_floating && interferences.size() >= INTEGER_REGISTERS.size()) continue;
+            const auto is_floating = (node.type().register_class() == sem::RegisterClass::Floating);
+            return interferences.size() < (is_floating ? FLOATING_REGISTERS.size() : INTEGER_REGISTERS.size());
+        });
 
-            stack.push(node);
-            work_list.erase(node);
-            found = true;
-            break;
+        if (simplifiable != work_list.end()) {
+            stack.push(*simplifiable);
+            work_list.erase(simplifiable);
+            continue;
         }
 
-        if (found) continue;
-
-        const auto &first = *work_list.begin();
-        _spilled.push_back(first);
-        work_list.erase(first);
+        _spilled.push_back(*work_list.begin());
+        work_list.erase(work_list.begin());
     }
 
     while (!stack.empty()) {
@@ -98,7 +108,7 @@ void RegisterAllocater::_simplify() {
         }
 
         auto found = false;
-        if (std::holds_alternative<sem::Floating>(node.type())) {
+        if (node.type().register_class() == sem::RegisterClass::Floating) {
             for (const auto base: FLOATING_REGISTERS) {
                 if (colors.contains(base)) continue;
                 _assigned[node] = base;
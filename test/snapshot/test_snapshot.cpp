@@ -1,9 +1,10 @@
 #include <filesystem>
-#include <fstream>
+#include <sstream>
 
 #include "gtest/gtest.h"
 
 #include "front/scanner.hpp"
+#include "front/source.hpp"
 #include "snapshot.hpp"
 
 static const std::string FILES = TEST_PATH "/snapshot/scanner/";
@@ -18,11 +19,9 @@ TEST(Snapshot, Scanner) {
 
         SnapshotTester tester(snapshot_file);
 
-        std::ifstream source_file(entry.path().string());
-        std::stringstream source;
-        source << source_file.rdbuf();
-
-        auto scanner = arkoi::front::Scanner(source.str());
+        const auto source = arkoi::front::Source::map(entry.path());
+        DiagnosticEngine diagnostics;
+        auto scanner = arkoi::front::Scanner(source.data(), diagnostics);
 
         std::stringstream output;
         for (const auto &token: scanner.tokenize()) {
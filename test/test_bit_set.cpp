@@ -0,0 +1,137 @@
+#include <random>
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "utils/bit_set.hpp"
+
+using testing::ElementsAre;
+
+template<typename Set>
+static std::vector<size_t> indices(const Set &set) {
+    std::vector<size_t> result;
+    set.for_each([&](size_t index) { result.push_back(index); });
+    return result;
+}
+
+template<typename Set>
+class BitSetTest : public testing::Test {};
+
+using SetTypes = testing::Types<BitSet, SparseBitSet>;
+TYPED_TEST_SUITE(BitSetTest, SetTypes);
+
+TYPED_TEST(BitSetTest, SetsAndResetsAcrossWords) {
+    TypeParam set(200);
+    set.set(0);
+    set.set(63);
+    set.set(64);
+    set.set(199);
+
+    EXPECT_TRUE(set.test(63));
+    EXPECT_FALSE(set.test(62));
+    EXPECT_EQ(set.count(), 4);
+    EXPECT_THAT(indices(set), ElementsAre(0, 63, 64, 199));
+
+    set.reset(64);
+    set.reset(65);
+    EXPECT_THAT(indices(set), ElementsAre(0, 63, 199));
+}
+
+TYPED_TEST(BitSetTest, CombinesSets) {
+    TypeParam left(300), right(300);
+    left.set(1);
+    left.set(130);
+    left.set(260);
+    right.set(130);
+    right.set(131);
+    right.set(70);
+
+    auto united = left;
+    united |= right;
+    EXPECT_THAT(indices(united), ElementsAre(1, 70, 130, 131, 260));
+
+    auto intersected = left;
+    intersected &= right;
+    EXPECT_THAT(indices(intersected), ElementsAre(130));
+
+    auto subtracted = left;
+    subtracted -= right;
+    EXPECT_THAT(indices(subtracted), ElementsAre(1, 260));
+}
+
+TYPED_TEST(BitSetTest, ComparesByContent) {
+    TypeParam left(100), right(100);
+    EXPECT_TRUE(left.empty());
+
+    left.set(70);
+    EXPECT_NE(left, right);
+
+    right.set(70);
+    right.set(71);
+    right.reset(71);
+    EXPECT_EQ(left, right);
+
+    left.reset(70);
+    EXPECT_TRUE(left.empty());
+    EXPECT_EQ(left, TypeParam(100));
+}
+
+TEST(SparseBitSet, MatchesDenseSets) {
+    std::mt19937 random(42);
+    std::uniform_int_distribution<size_t> index(0, 999);
+
+    for (size_t round = 0; round < 100; round++) {
+        BitSet dense_left(1000), dense_right(1000);
+        SparseBitSet sparse_left(1000), sparse_right(1000);
+        for (size_t count = 0; count < 50; count++) {
+            // The rounds spread the left indices further and further, thus the overlap of both sets varies.
+            const auto left = index(random) % (10 * round + 10), right = index(random);
+            dense_left.set(left), sparse_left.set(left);
+            dense_right.set(right), sparse_right.set(right);
+        }
+
+        auto dense = dense_left;
+        auto sparse = sparse_left;
+        dense &= dense_right, sparse &= sparse_right;
+        EXPECT_EQ(indices(sparse), indices(dense));
+
+        dense = dense_left, sparse = sparse_left;
+        dense -= dense_right, sparse -= sparse_right;
+        EXPECT_EQ(indices(sparse), indices(dense));
+
+        dense = dense_left, sparse = sparse_left;
+        dense |= dense_right, sparse |= sparse_right;
+        EXPECT_EQ(indices(sparse), indices(dense));
+    }
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
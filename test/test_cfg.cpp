@@ -1,6 +1,10 @@
+#include <algorithm>
+#include <limits>
+
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "il/analyses.hpp"
 #include "il/cfg.hpp"
 
 using testing::ElementsAre;
@@ -18,12 +22,12 @@ using namespace arkoi;
  *                  [   exit   ]
  */
 il::Function create_example_cfg() {
-    il::Function function("main", std::vector<il::Variable>(), sem::Boolean());
+    il::Function function(Name("main"), std::vector<il::Variable>(), sem::Boolean());
 
-    auto *next_1_block = function.emplace_back("next_1");
-    auto *next_2_block = function.emplace_back("next_2");
-    auto *branch_2_block = function.emplace_back("branch_2");
-    auto *branch_1_block = function.emplace_back("branch_1");
+    auto *next_1_block = function.emplace_back(Name("next_1"));
+    auto *next_2_block = function.emplace_back(Name("next_2"));
+    auto *branch_2_block = function.emplace_back(Name("branch_2"));
+    auto *branch_1_block = function.emplace_back(Name("branch_1"));
 
     function.entry()->set_next(next_1_block);
     function.entry()->set_branch(branch_1_block);
@@ -46,13 +50,158 @@ TEST(ControlFlowGraph, IteratorRightOrder) {
     std::transform(function.begin(), function.end(),
                    std::back_inserter(labels),
                    [](const il::BasicBlock &block) {
-                       return block.label();
+                       return std::string(block.label().view());
                    });
 
     ASSERT_EQ(labels.size(), 6);
     EXPECT_THAT(labels, ElementsAre("main_entry", "next_1", "next_2", "branch_2", "branch_1", "main_exit"));
 }
 
+TEST(ControlFlowGraph, PostorderVisitsSuccessorsFirst) {
+    il::Function function = create_example_cfg();
+
+    std::vector<std::string> labels;
+    for (const auto *block: function.postorder()) labels.emplace_back(block->label().view());
+
+    EXPECT_THAT(labels, ElementsAre("main_exit", "next_2", "branch_2", "next_1", "branch_1", "main_entry"));
+}
+
+TEST(ControlFlowGraph, LivenessConvergesInOnePass) {
+    const il::Variable condition(il::VRegId(0), Name("condition"), sem::Boolean());
+    il::Function function(Name("main"), {condition}, sem::Boolean());
+
+    auto *next_block = function.emplace_back(Name("next"));
+    auto *branch_block = function.emplace_back(Name("branch"));
+
+    function.entry()->set_next(next_block);
+    function.entry()->set_branch(branch_block);
+    function.entry()->emplace_back<il::If>(condition, next_block->label(), branch_block->label());
+
+    next_block->set_next(function.exit());
+    next_block->emplace_back<il::Goto>(function.exit()->label());
+
+    branch_block->set_next(function.exit());
+    branch_block->emplace_back<il::Goto>(function.exit()->label());
+
+    function.exit()->emplace_back<il::Return>(condition);
+
+    const il::OperandIndex operands(function);
+    il::DataflowAnalysis<il::BlockLivenessAnalysis<>> liveness(operands);
+    liveness.run(function);
+
+    EXPECT_EQ(liveness.iterations(), 4);
+    for (auto &block: function) {
+        EXPECT_TRUE(liveness.in().at(&block).test(0));
+    }
+}
+
+/**
+ * The shortest distance of a block from the entry, thus the solver is also checked with a lattice other than sets.
+ */
+class DistanceLattice {
+public:
+    using Value = size_t;
+
+public:
+    [[nodiscard]] Value top() const { return std::numeric_limits<size_t>::max(); }
+
+    [[nodiscard]] Value bottom() const { return 0; }
+
+    void meet(Value &value, const Value &other) const { value = std::min(value, other); }
+};
+
+class DistanceAnalysis final :
+        public il::DataflowPass<DistanceLattice, il::DataflowDirection::Forward, il::DataflowGranularity::Block> {
+public:
+    [[nodiscard]] const Lattice &lattice() const override { return _lattice; }
+
+    State boundary(il::Function &) override { return 0; }
+
+    State initialize(il::Function &, il::BasicBlock &) override { return _lattice.top(); }
+
+    State transfer(il::BasicBlock &, const State &state) override { return state + 1; }
+
+private:
+    DistanceLattice _lattice;
+};
+
+TEST(ControlFlowGraph, SolvesNonSetLattices) {
+    il::Function function = create_example_cfg();
+    for (auto &block: function) block.emplace_back<il::Goto>(function.exit()->label());
+
+    il::DataflowAnalysis<DistanceAnalysis> distances;
+    distances.run(function);
+
+    EXPECT_EQ(distances.iterations(), 6);
+    EXPECT_EQ(distances.out().at(function.entry()), 1);
+    EXPECT_EQ(distances.in().at(function.exit()), 2);
+    EXPECT_EQ(distances.out().at(function.exit()), 3);
+}
+
+TEST(ControlFlowGraph, SetLatticesMeet) {
+    const il::UnionLattice<BitSet> may(3);
+    const il::IntersectionLattice<SparseBitSet> must(3);
+    EXPECT_EQ(may.bottom().count(), 3);
+    EXPECT_EQ(must.top().count(), 3);
+
+    auto value = may.top();
+    value.set(0);
+    may.meet(value, may.bottom());
+    EXPECT_EQ(value, may.bottom());
+
+    auto other = must.top();
+    other.reset(1);
+    must.meet(other, must.bottom());
+    EXPECT_EQ(other, must.bottom());
+}
+
+TEST(ControlFlowGraph, ReplaysInstructionLiveness) {
+    const il::Variable a(il::VRegId(0), Name("a"), sem::TypeId::S32);
+    il::Function function(Name("main"), {a}, sem::TypeId::S32);
+
+    const il::Variable b(function.make_vreg(), Name("b"), sem::TypeId::S32);
+    const il::Variable c(function.make_vreg(), Name("c"), sem::TypeId::S32);
+
+    function.entry()->set_next(function.exit());
+    function.entry()->emplace_back<il::Binary>(b, a, il::Binary::Operator::Add, a, sem::TypeId::S32);
+    function.entry()->emplace_back<il::Binary>(c, b, il::Binary::Operator::Mul, a, sem::TypeId::S32);
+    function.entry()->emplace_back<il::Goto>(function.exit()->label());
+    function.exit()->emplace_back<il::Return>(c);
+
+    const il::OperandIndex operands(function);
+    il::DataflowAnalysis<il::BlockLivenessAnalysis<>> blocks(operands);
+    blocks.run(function);
+    il::DataflowAnalysis<il::InstructionLivenessAnalysis<>> instructions(operands);
+    instructions.run(function);
+
+    size_t replayed = 0;
+    for (auto &block: function) {
+        il::LivenessReplay replay(block, blocks.out().at(&block), operands);
+        for (const auto &[instruction, live_out]: replay) {
+            EXPECT_EQ(live_out, instructions.out().at(&instruction));
+            replayed++;
+        }
+    }
+
+    EXPECT_EQ(replayed, 4);
+}
+
+TEST(ControlFlowGraph, NumbersVRegsAfterParameters) {
+    std::vector<il::Variable> parameters{
+        il::Variable(il::VRegId(0), Name("a"), sem::TypeId::S32),
+        il::Variable(il::VRegId(1), Name("b"), sem::TypeId::F64),
+    };
+    il::Function function(Name("main"), parameters, sem::Boolean());
+
+    EXPECT_EQ(function.vreg_count(), 2);
+    EXPECT_EQ(function.make_vreg(), il::VRegId(2));
+    EXPECT_EQ(function.vreg_count(), 3);
+
+    // Only the virtual register identifies a variable, the name is just kept to print it.
+    EXPECT_EQ(il::Variable(il::VRegId(0), Name("a"), sem::TypeId::S32), parameters[0]);
+    EXPECT_NE(il::Variable(il::VRegId(2), Name("a"), sem::TypeId::S32), parameters[0]);
+}
+
 //==============================================================================
 // BSD 3-Clause License
 //
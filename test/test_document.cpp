@@ -0,0 +1,162 @@
+#include <algorithm>
+#include <random>
+
+#include "gtest/gtest.h"
+
+#include "front/document.hpp"
+#include "front/scanner.hpp"
+
+using namespace arkoi::front;
+using namespace arkoi;
+
+static const std::string SOURCE =
+    "# Some functions\n"
+    "fun first(a @s32) @s32:\n"
+    "    return a\n"
+    "\n"
+    "fun second(a @s32) @s32:\n"
+    "    if a < 1:\n"
+    "        return 1\n"
+    "    return first(a)\n"
+    "\n"
+    "fun third() @s32:\n"
+    "    return second(2)\n";
+
+static std::vector<ast::Node *> statements(Document &document) {
+    const auto program = document.program();
+    return {program.statements().begin(), program.statements().end()};
+}
+
+static bool operator==(const Token &lhs, const Token &rhs) {
+    return lhs.type() == rhs.type() && lhs.contents() == rhs.contents() && lhs.offset() == rhs.offset();
+}
+
+TEST(Document, ReusesUntouchedFunctions) {
+    Document document(SOURCE);
+    const auto before = statements(document);
+    ASSERT_EQ(before.size(), 3);
+
+    const auto offset = SOURCE.find("return 1");
+    EXPECT_EQ(document.apply({offset + 7, 1, "42"}), 1);
+
+    const auto after = statements(document);
+    ASSERT_EQ(after.size(), 3);
+    EXPECT_EQ(after[0], before[0]);
+    EXPECT_NE(after[1], before[1]);
+    EXPECT_EQ(after[2], before[2]);
+    EXPECT_FALSE(document.has_failed());
+    EXPECT_NE(document.text().find("return 42\n"), std::string::npos);
+}
+
+TEST(Document, MergesFunctionWithoutKeyword) {
+    Document document(SOURCE);
+    const auto before = statements(document);
+
+    // Without the keyword, the line belongs to the body of the previous function.
+    EXPECT_EQ(document.apply({SOURCE.find("fun third"), 4, ""}), 1);
+    EXPECT_TRUE(document.has_failed());
+    EXPECT_EQ(statements(document)[0], before[0]);
+
+    EXPECT_EQ(document.apply({SOURCE.find("fun third"), 0, "fun "}), 2);
+    EXPECT_FALSE(document.has_failed());
+    EXPECT_EQ(statements(document).size(), 3);
+}
+
+TEST(Document, LocatesLaterChunksInWholeText) {
+    Document document(SOURCE);
+
+    const auto offset = SOURCE.find("second(2)");
+    EXPECT_EQ(document.apply({offset + 7, 1, "$42"}), 1);
+
+    const auto text = document.text();
+    const auto tokens = document.tokens();
+    ASSERT_FALSE(tokens.empty());
+
+    const auto number = std::ranges::find(tokens, std::string_view("42"), &Token::contents);
+    ASSERT_NE(number, tokens.end());
+    EXPECT_EQ(number->offset(), text.find("42"));
+
+    const auto function = std::ranges::find(tokens, std::string_view("third"), &Token::contents);
+    ASSERT_NE(function, tokens.end());
+    EXPECT_EQ(function->offset(), text.find("third"));
+
+    EXPECT_EQ(tokens.back().type(), Token::Type::EndOfFile);
+    EXPECT_EQ(tokens.back().offset(), text.size());
+
+    const auto diagnostics = document.diagnostics();
+    ASSERT_EQ(diagnostics.size(), 1);
+    ASSERT_TRUE(diagnostics.front().span().has_value());
+    EXPECT_EQ(diagnostics.front().span()->offset, text.find('$'));
+}
+
+TEST(Document, MatchesFreshDocument) {
+    static const std::vector<std::string> FRAGMENTS{
+        "fun ", "x", "\n", "    ", "return 1\n", "fun added() @s32:\n    return 0\n", ":", "", "(a @s32)",
+    };
+
+    std::mt19937 random(42);
+    Document document(SOURCE);
+    auto expected = SOURCE;
+
+    for (size_t index = 0; index < 500; index++) {
+        const auto offset = random() % (expected.size() + 1);
+        const auto length = std::min<size_t>(random() % 8, expected.size() - offset);
+        const auto &replacement = FRAGMENTS[random() % FRAGMENTS.size()];
+
+        std::ignore = document.apply({offset, length, replacement});
+        expected.replace(offset, length, replacement);
+        ASSERT_EQ(document.text(), expected);
+
+        // Scanning the whole text at once results in the same tokens and offsets as the chunks do.
+        DiagnosticEngine diagnostics;
+        const auto tokens = document.tokens(), scanned = Scanner(expected, diagnostics).tokenize();
+        ASSERT_EQ(tokens.size(), scanned.size()) << index;
+        for (size_t token = 0; token < tokens.size(); token++) {
+            ASSERT_TRUE(tokens[token] == scanned[token]) << index;
+        }
+
+        Document fresh(expected);
+        const auto reported = document.diagnostics(), fresh_reported = fresh.diagnostics();
+        ASSERT_EQ(reported.size(), fresh_reported.size()) << index;
+        for (size_t diagnostic = 0; diagnostic < reported.size(); diagnostic++) {
+            EXPECT_EQ(reported[diagnostic].code(), fresh_reported[diagnostic].code()) << index;
+            EXPECT_EQ(reported[diagnostic].span().has_value(), fresh_reported[diagnostic].span().has_value());
+            if (!reported[diagnostic].span()) continue;
+            EXPECT_EQ(reported[diagnostic].span()->offset, fresh_reported[diagnostic].span()->offset) << index;
+        }
+
+        EXPECT_EQ(document.has_failed(), fresh.has_failed());
+        EXPECT_EQ(statements(document).size(), statements(fresh).size());
+    }
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,79 @@
+#include <type_traits>
+
+#include "gtest/gtest.h"
+
+#include "ast/nodes.hpp"
+
+using namespace arkoi;
+
+static_assert(!std::is_polymorphic_v<ast::Node>);
+
+namespace {
+
+// Node::accept only needs the overloads, not the ast::Visitor interface.
+struct KindCounter {
+    size_t returns{}, immediates{};
+
+    void visit(ast::Return &node) {
+        returns++;
+        node.expression()->accept(*this);
+    }
+
+    void visit(ast::Immediate &) { immediates++; }
+
+    void visit(ast::Node &) {}
+};
+
+} // namespace
+
+TEST(Nodes, DispatchesOnTag) {
+    ast::Immediate immediate(front::Token(front::Token::Type::Integer, 0, "42", int64_t{42}), ast::Immediate::Kind::Integer);
+    ast::Return statement(&immediate);
+
+    KindCounter counter;
+    static_cast<ast::Node &>(statement).accept(counter);
+
+    EXPECT_EQ(counter.returns, 1);
+    EXPECT_EQ(counter.immediates, 1);
+}
+
+TEST(Nodes, CastsByTag) {
+    ast::Immediate immediate(front::Token(front::Token::Type::Integer, 0, "42", int64_t{42}), ast::Immediate::Kind::Integer);
+    ast::Return statement(&immediate);
+
+    ast::Node *node = &statement;
+    EXPECT_EQ(node->tag(), ast::Node::Tag::Return);
+    EXPECT_EQ(ast::node_cast<ast::Return>(node), &statement);
+    EXPECT_EQ(ast::node_cast<ast::Immediate>(node), nullptr);
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,250 @@
+#include <array>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+#include "gtest/gtest.h"
+
+#include "front/parser.hpp"
+#include "front/scanner.hpp"
+#include "utils/line_table.hpp"
+
+using namespace arkoi::front;
+using namespace arkoi;
+
+static std::string generate_functions(size_t count, bool misindented) {
+    std::string source = "# A comment before the first function\n\n";
+    for (size_t index = 0; index < count; index++) {
+        source += "fun function_" + std::to_string(index) + "(a @s32) @s32:\n";
+        source += "    if a < 1:\n";
+        source += "        return a\n";
+        source += "\n";
+
+        // Misindented lines are skipped without being assigned a row.
+        if (misindented) source += "   \n";
+        source += "    return a + " + std::to_string(index) + "\n\n";
+    }
+
+    return source;
+}
+
+static std::string print_expression(ast::Node *node) {
+    if (auto *binary = ast::node_cast<ast::Binary>(node)) {
+        static constexpr std::array OPERATORS{"+", "-", "*", "/", ">", "<"};
+        const auto op = OPERATORS[static_cast<size_t>(binary->op())];
+        return "(" + print_expression(binary->left()) + " " + op + " " + print_expression(binary->right()) + ")";
+    }
+
+    if (auto *immediate = ast::node_cast<ast::Immediate>(node)) {
+        return std::string(immediate->value().contents());
+    }
+
+    if (auto *identifier = ast::node_cast<ast::Identifier>(node)) {
+        return std::string(identifier->value().contents());
+    }
+
+    return "?";
+}
+
+static std::string parse_expression(const std::string &expression) {
+    const auto source = "fun main() @s32:\n    return " + expression + "\n";
+
+    ast::AstArena arena;
+    DiagnosticEngine diagnostics;
+    Scanner scanner(source, diagnostics);
+    Parser parser(scanner, arena, diagnostics);
+    const auto program = parser.parse_program();
+    if (parser.has_failed()) return "failed";
+
+    auto *function = ast::node_cast<ast::Function>(program.statements().front());
+    auto *statement = ast::node_cast<ast::Return>(function->block()->statements().front());
+    return print_expression(statement->expression());
+}
+
+TEST(ParallelParser, SplitKeepsOffsets) {
+    const auto source = generate_functions(16, true);
+
+    const auto chunks = Scanner::split(source, 0);
+    ASSERT_EQ(chunks.size(), 17);
+
+    DiagnosticEngine diagnostics;
+
+    std::vector<Token> expected;
+    for (const auto &token: Scanner(source, diagnostics).tokenize()) {
+        if (token.type() == Token::Type::Dedentation || token.type() == Token::Type::EndOfFile) continue;
+        expected.push_back(token);
+    }
+
+    std::vector<Token> actual;
+    for (const auto &[data, offset]: chunks) {
+        for (const auto &token: Scanner(data, diagnostics, offset).tokenize()) {
+            if (token.type() == Token::Type::Dedentation || token.type() == Token::Type::EndOfFile) continue;
+            actual.push_back(token);
+        }
+    }
+
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t index = 0; index < expected.size(); index++) {
+        EXPECT_EQ(actual[index].type(), expected[index].type()) << index;
+        EXPECT_EQ(actual[index].contents(), expected[index].contents()) << index;
+        EXPECT_EQ(actual[index].offset(), expected[index].offset()) << index;
+    }
+}
+
+TEST(ParallelParser, KeepsFunctionOrder) {
+    const auto source = generate_functions(100, false);
+
+    ast::AstArena arena;
+    DiagnosticEngine diagnostics;
+    ThreadPool pool(4);
+    const auto program = Parser::parse_program(source, arena, diagnostics, pool);
+    ASSERT_TRUE(program.has_value());
+
+    const auto &statements = program->statements();
+    ASSERT_EQ(statements.size(), 100);
+    for (size_t index = 0; index < statements.size(); index++) {
+        auto *function = ast::node_cast<ast::Function>(statements[index]);
+        ASSERT_NE(function, nullptr);
+        EXPECT_EQ(function->name().value().contents(), "function_" + std::to_string(index));
+        const auto name = "function_" + std::to_string(index) + "(";
+        EXPECT_EQ(function->name().value().offset(), source.find(name));
+    }
+}
+
+TEST(Parser, ClimbsPrecedence) {
+    EXPECT_EQ(parse_expression("1 + 2 * 3 - 4 < 5 / 6"), "(((1 + (2 * 3)) - 4) < (5 / 6))");
+    EXPECT_EQ(parse_expression("a - b - c * d / e"), "((a - b) - ((c * d) / e))");
+    EXPECT_EQ(parse_expression("(a < b) > a + (b - c)"), "((a < b) > (a + (b - c)))");
+    EXPECT_EQ(parse_expression("1 + * 2"), "failed");
+
+    std::string nested = "1", expected = "1";
+    for (size_t index = 0; index < 256; index++) {
+        nested = "(" + nested + " + 1)";
+        expected = "(" + expected + " + 1)";
+    }
+    EXPECT_EQ(parse_expression(nested), expected);
+}
+
+TEST(Parser, RecoversFromErrors) {
+    const std::string source = "fun broken(a @s32, @s32) @s32:\n"
+                               "    return (1 +\n"
+                               "    return a\n"
+                               "\n"
+                               "fun working() @s32:\n"
+                               "    return 1\n";
+
+    ast::AstArena arena;
+    DiagnosticEngine diagnostics;
+    Scanner scanner(source, diagnostics);
+    Parser parser(scanner, arena, diagnostics);
+    const auto program = parser.parse_program();
+    EXPECT_TRUE(parser.has_failed());
+
+    const auto &reported = diagnostics.diagnostics();
+    ASSERT_EQ(reported.size(), 2);
+    EXPECT_EQ(reported[0].message(), "Expected Identifier but got At");
+    EXPECT_EQ(reported[0].span()->offset, 19);
+    EXPECT_EQ(reported[1].message(), "Expected integer, float, identifier, function call, grouping, true or false "
+                                     "but got Newline");
+
+    ASSERT_EQ(program.statements().size(), 2);
+    auto *function = ast::node_cast<ast::Function>(program.statements()[1]);
+    ASSERT_NE(function, nullptr);
+    EXPECT_EQ(function->name().value().contents(), "working");
+}
+
+TEST(ParallelParser, KeepsDiagnosticOrder) {
+    std::string source;
+    for (size_t index = 0; index < 64; index++) {
+        source += "fun function_" + std::to_string(index) + "() @s32:\n";
+        source += "    return $" + std::to_string(index) + "\n\n";
+    }
+
+    DiagnosticEngine serial_diagnostics(10);
+    {
+        ast::AstArena arena;
+        Scanner scanner(source, serial_diagnostics);
+        Parser parser(scanner, arena, serial_diagnostics);
+        std::ignore = parser.parse_program();
+    }
+
+    DiagnosticEngine parallel_diagnostics(10);
+    {
+        ast::AstArena arena;
+        ThreadPool pool(4);
+        EXPECT_FALSE(Parser::parse_program(source, arena, parallel_diagnostics, pool).has_value());
+    }
+
+    const auto &serial = serial_diagnostics.diagnostics();
+    const auto &parallel = parallel_diagnostics.diagnostics();
+    ASSERT_EQ(serial.size(), 10);
+    ASSERT_EQ(parallel.size(), serial.size());
+    for (size_t index = 0; index < serial.size(); index++) {
+        EXPECT_EQ(parallel[index].message(), serial[index].message()) << index;
+        EXPECT_EQ(parallel[index].span()->offset, serial[index].span()->offset) << index;
+    }
+}
+
+static std::string render_diagnostics(const std::string &source, size_t threads) {
+    DiagnosticEngine diagnostics;
+    ast::AstArena arena;
+
+    if (threads == 0) {
+        Scanner scanner(source, diagnostics);
+        Parser parser(scanner, arena, diagnostics);
+        std::ignore = parser.parse_program();
+    } else {
+        ThreadPool pool(threads);
+        std::ignore = Parser::parse_program(source, arena, diagnostics, pool);
+    }
+
+    std::stringstream output;
+    diagnostics.render(output, LineTable(source));
+    return output.str();
+}
+
+TEST(ParallelParser, RecoversAcrossChunks) {
+    const std::array sources{
+        std::string("fun main() @s32:\n  return 1.0 > foo()\nfun foo() @bool:\n  return 1\n"),
+        std::string("fun a() @s32:\nfun b() @s32:\n    return $\nfun c() @s32:\nfun d() @s32:\n    return 1\n"),
+        std::string("fun a(x\nfun b() @s32:\n    return 1\n"),
+    };
+
+    for (const auto &source: sources) {
+        const auto serial = render_diagnostics(source, 0);
+        EXPECT_FALSE(serial.empty());
+        EXPECT_EQ(render_diagnostics(source, 2), serial) << source;
+        EXPECT_EQ(render_diagnostics(source, 4), serial) << source;
+    }
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,238 @@
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "front/parser.hpp"
+#include "front/scanner.hpp"
+#include "il/generator.hpp"
+#include "il/il_printer.hpp"
+#include "sem/fused_resolver.hpp"
+#include "sem/name_resolver.hpp"
+#include "sem/type_resolver.hpp"
+
+using namespace arkoi::front;
+using namespace arkoi;
+
+// Every function declares a local in a nested block and calls the previous one, while a few of them contain name or
+// type errors.
+static std::string generate_functions(size_t count) {
+    std::string source;
+    for (size_t index = 0; index < count; index++) {
+        source += "fun function_" + std::to_string(index) + "(a @s32, b @f64) @s32:\n";
+        source += "    c @s32 = a + 1\n";
+        if (index % 5 == 0) source += "    c @s32 = 2\n";
+        source += "    if c < 2:\n";
+        source += "        d @bool = b\n";
+        source += "        return c\n";
+        if (index % 7 == 0) source += "    missing = 3\n";
+        if (index % 3 == 0) source += "    function_" + std::to_string(index) + "(c)\n";
+        if (index == 0) source += "    return 0\n";
+        else source += "    return function_" + std::to_string(index - 1) + "(c, a)\n";
+        source += "\n";
+    }
+
+    return source;
+}
+
+static std::vector<std::tuple<Diagnostic::Code, uint32_t>> codes(const DiagnosticEngine &diagnostics) {
+    std::vector<std::tuple<Diagnostic::Code, uint32_t>> codes;
+    for (const auto &diagnostic: diagnostics.diagnostics()) {
+        codes.emplace_back(diagnostic.code(), diagnostic.span() ? diagnostic.span()->offset : 0);
+    }
+    return codes;
+}
+
+TEST(ParallelResolver, EqualsSerialResolver) {
+    const auto source = generate_functions(64);
+
+    ast::AstArena serial_arena, parallel_arena;
+    sem::SymbolArena serial_symbols, parallel_symbols;
+    DiagnosticEngine serial_diagnostics, parallel_diagnostics;
+    ThreadPool pool(4);
+
+    Scanner serial_scanner(source, serial_diagnostics);
+    Parser serial_parser(serial_scanner, serial_arena, serial_diagnostics);
+    auto serial_program = serial_parser.parse_program();
+    ASSERT_FALSE(serial_parser.has_failed());
+
+    auto parallel_program = Parser::parse_program(source, parallel_arena, parallel_diagnostics, pool);
+    ASSERT_TRUE(parallel_program.has_value());
+
+    const auto serial_names = sem::NameResolver::resolve(serial_program, serial_symbols, serial_diagnostics);
+    const auto parallel_names = sem::NameResolver::resolve(*parallel_program, parallel_symbols, parallel_diagnostics,
+                                                           pool);
+    EXPECT_TRUE(serial_names.has_failed());
+    EXPECT_TRUE(parallel_names.has_failed());
+    EXPECT_EQ(codes(parallel_diagnostics), codes(serial_diagnostics));
+}
+
+TEST(ParallelResolver, KeepsTypeDiagnosticOrder) {
+    std::string source;
+    for (size_t index = 0; index < 64; index++) {
+        source += "fun function_" + std::to_string(index) + "(a @s32) @f64:\n";
+        source += "    b @f64 = a\n";
+        if (index % 3 == 0) source += "    return function_" + std::to_string(index) + "()\n";
+        source += "    return b\n\n";
+    }
+
+    ast::AstArena arena;
+    sem::SymbolArena symbols;
+    DiagnosticEngine diagnostics;
+    ThreadPool pool(4);
+
+    auto program = Parser::parse_program(source, arena, diagnostics, pool);
+    ASSERT_TRUE(program.has_value());
+
+    const auto names = sem::NameResolver::resolve(*program, symbols, diagnostics, pool);
+    ASSERT_FALSE(names.has_failed());
+
+    // Every function, parameter and local fills exactly one of the reserved slots.
+    EXPECT_EQ(symbols.size(), 64 * 3);
+
+    const auto types = sem::TypeResolver::resolve(*program, arena, symbols, diagnostics, pool);
+    EXPECT_TRUE(types.has_failed());
+
+    const auto &reported = diagnostics.diagnostics();
+    ASSERT_EQ(reported.size(), 22);
+    for (size_t index = 0; index < reported.size(); index++) {
+        EXPECT_EQ(reported[index].code(), Diagnostic::Code::ArgumentCountMismatch);
+        const auto call = "function_" + std::to_string(index * 3) + "()";
+        EXPECT_EQ(reported[index].span()->offset, source.find(call));
+    }
+}
+
+TEST(FusedResolver, EqualsTwoPassNameDiagnostics) {
+    const auto source = generate_functions(64);
+
+    ast::AstArena arena;
+    sem::SymbolArena two_pass_symbols, fused_symbols;
+    DiagnosticEngine diagnostics, two_pass_diagnostics, fused_diagnostics;
+
+    Scanner scanner(source, diagnostics);
+    Parser parser(scanner, arena, diagnostics);
+    auto program = parser.parse_program();
+    ASSERT_FALSE(parser.has_failed());
+
+    const auto names = sem::NameResolver::resolve(program, two_pass_symbols, two_pass_diagnostics);
+    EXPECT_TRUE(names.has_failed());
+
+    const auto fused = sem::FusedResolver::resolve(program, arena, fused_symbols, fused_diagnostics);
+    EXPECT_TRUE(fused.has_failed());
+
+    EXPECT_EQ(codes(fused_diagnostics), codes(two_pass_diagnostics));
+}
+
+TEST(FusedResolver, EqualsTwoPassTypeDiagnostics) {
+    std::string source;
+    for (size_t index = 0; index < 16; index++) {
+        const auto next = "function_" + std::to_string(index + 1);
+        source += "fun function_" + std::to_string(index) + "(a @s32, b @f64) @f64:\n";
+        source += "    c @u8 = a + b\n";
+        if (index % 2 == 0) source += "    " + next + "(" + next + "(a))\n";
+        if (index % 3 == 0) source += "    " + next + "(true, b < 2.0)\n";
+        source += "    return a\n\n";
+    }
+    source += "fun function_16(a @s32, b @f64) @f64:\n    return b\n";
+
+    DiagnosticEngine diagnostics;
+    std::vector<std::tuple<Diagnostic::Code, uint32_t>> expected, actual;
+
+    {
+        ast::AstArena arena;
+        sem::SymbolArena symbols;
+        DiagnosticEngine two_pass_diagnostics;
+
+        Scanner scanner(source, diagnostics);
+        Parser parser(scanner, arena, diagnostics);
+        auto program = parser.parse_program();
+        ASSERT_FALSE(parser.has_failed());
+
+        ASSERT_FALSE(sem::NameResolver::resolve(program, symbols, two_pass_diagnostics).has_failed());
+        EXPECT_TRUE(sem::TypeResolver::resolve(program, arena, symbols, two_pass_diagnostics).has_failed());
+        expected = codes(two_pass_diagnostics);
+    }
+
+    {
+        ast::AstArena arena;
+        sem::SymbolArena symbols;
+        DiagnosticEngine fused_diagnostics;
+
+        Scanner scanner(source, diagnostics);
+        Parser parser(scanner, arena, diagnostics);
+        auto program = parser.parse_program();
+        ASSERT_FALSE(parser.has_failed());
+
+        EXPECT_TRUE(sem::FusedResolver::resolve(program, arena, symbols, fused_diagnostics).has_failed());
+        actual = codes(fused_diagnostics);
+    }
+
+    EXPECT_FALSE(expected.empty());
+    EXPECT_EQ(actual, expected);
+}
+
+TEST(FusedResolver, InsertsTheSameCasts) {
+    std::string source;
+    for (size_t index = 0; index < 16; index++) {
+        source += "fun function_" + std::to_string(index) + "(a @u8, b @f32) @f64:\n";
+        source += "    c @s64 = a * 3 + b\n";
+        source += "    if c:\n";
+        source += "        c = function_" + std::to_string((index + 1) % 16) + "(c, c)\n";
+        source += "    return c\n\n";
+    }
+
+    const auto generate = [&source](bool fused) {
+        ast::AstArena arena;
+        sem::SymbolArena symbols;
+        DiagnosticEngine diagnostics;
+
+        Scanner scanner(source, diagnostics);
+        Parser parser(scanner, arena, diagnostics);
+        auto program = parser.parse_program();
+        EXPECT_FALSE(parser.has_failed());
+
+        if (fused) {
+            EXPECT_FALSE(sem::FusedResolver::resolve(program, arena, symbols, diagnostics).has_failed());
+        } else {
+            EXPECT_FALSE(sem::NameResolver::resolve(program, symbols, diagnostics).has_failed());
+            EXPECT_FALSE(sem::TypeResolver::resolve(program, arena, symbols, diagnostics).has_failed());
+        }
+
+        auto module = il::Generator::generate(program, symbols);
+        return il::ILPrinter::print(module).str();
+    };
+
+    EXPECT_EQ(generate(true), generate(false));
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
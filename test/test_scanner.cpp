@@ -0,0 +1,131 @@
+#include <limits>
+#include <tuple>
+
+#include "gtest/gtest.h"
+
+#include "front/scanner.hpp"
+
+using namespace arkoi::front;
+
+static Token::Number scan_number(std::string_view source) {
+    DiagnosticEngine diagnostics;
+    const auto tokens = Scanner(source, diagnostics).tokenize();
+    return tokens.front().number();
+}
+
+static std::vector<Diagnostic::Code> scan_errors(std::string_view source, size_t limit = 0) {
+    DiagnosticEngine diagnostics(limit);
+    std::ignore = Scanner(source, diagnostics).tokenize();
+
+    std::vector<Diagnostic::Code> codes;
+    for (const auto &diagnostic: diagnostics.diagnostics()) codes.push_back(diagnostic.code());
+    return codes;
+}
+
+TEST(Scanner, DecodesIntegers) {
+    EXPECT_EQ(std::get<int64_t>(scan_number("42")), 42);
+    EXPECT_EQ(std::get<int64_t>(scan_number("-42")), -42);
+    EXPECT_EQ(std::get<int64_t>(scan_number("0xCaFeBaBe")), 0xCAFEBABE);
+    EXPECT_EQ(std::get<int64_t>(scan_number("-0x10")), -16);
+    EXPECT_EQ(std::get<int64_t>(scan_number("'*'")), '*');
+    EXPECT_EQ(std::get<int64_t>(scan_number("9223372036854775807")), std::numeric_limits<int64_t>::max());
+    EXPECT_EQ(std::get<int64_t>(scan_number("-9223372036854775808")), std::numeric_limits<int64_t>::min());
+}
+
+TEST(Scanner, DecodesFloatings) {
+    EXPECT_EQ(std::get<double>(scan_number("42.0")), 42.0);
+    EXPECT_EQ(std::get<double>(scan_number("-42.")), -42.0);
+    EXPECT_EQ(std::get<double>(scan_number("42.0e+2")), 4200.0);
+    EXPECT_EQ(std::get<double>(scan_number("-42.E-2")), -0.42);
+    EXPECT_EQ(std::get<double>(scan_number("0x1.8p1")), 3.0);
+    EXPECT_EQ(std::get<double>(scan_number("0x1p4")), 16.0);
+    EXPECT_EQ(std::get<double>(scan_number("-0xA.8")), -10.5);
+}
+
+TEST(Scanner, RejectsOutOfRangeNumbers) {
+    using Codes = std::vector<Diagnostic::Code>;
+    EXPECT_EQ(scan_errors("9223372036854775808"), Codes{Diagnostic::Code::NumberOutOfRange});
+    EXPECT_EQ(scan_errors("-9223372036854775809"), Codes{Diagnostic::Code::NumberOutOfRange});
+    EXPECT_EQ(scan_errors("1.0e400"), Codes{Diagnostic::Code::NumberOutOfRange});
+}
+
+TEST(Scanner, RoundsUnderflowsToZero) {
+    EXPECT_TRUE(scan_errors("1e-400").empty());
+    EXPECT_TRUE(scan_errors("0x1p-2000").empty());
+    EXPECT_EQ(std::get<double>(scan_number("1e-400")), 0.0);
+    EXPECT_EQ(std::get<double>(scan_number("-1.5e-400")), 0.0);
+    EXPECT_EQ(scan_errors("-1.0e400"), std::vector{Diagnostic::Code::NumberOutOfRange});
+}
+
+TEST(Scanner, RecoversFromErrors) {
+    using Codes = std::vector<Diagnostic::Code>;
+    EXPECT_EQ(scan_errors("a $ b\n  c\n'ab\n0x"), (Codes{
+                  Diagnostic::Code::UnknownChar,
+                  Diagnostic::Code::Misindentation,
+                  Diagnostic::Code::UnexpectedChar,
+                  Diagnostic::Code::UnexpectedEndOfLine,
+              }));
+}
+
+TEST(Scanner, LocatesOffsets) {
+    const std::string source = "fun main() @s32:\n\n  # misindented\n    return $\n";
+
+    DiagnosticEngine diagnostics;
+    const auto tokens = Scanner(source, diagnostics).tokenize();
+
+    const LineTable lines(source);
+    const auto &reported = diagnostics.diagnostics();
+    ASSERT_EQ(reported.size(), 2);
+
+    const auto misindented = lines.locate(reported[0].span()->offset);
+    EXPECT_EQ(misindented.row, 2);
+    EXPECT_EQ(misindented.column, 0);
+
+    const auto unknown = lines.locate(reported[1].span()->offset);
+    EXPECT_EQ(unknown.row, 3);
+    EXPECT_EQ(unknown.column, 11);
+
+    const auto end = lines.locate(tokens.back().offset());
+    EXPECT_EQ(end.row, 4);
+    EXPECT_EQ(end.column, 0);
+}
+
+TEST(Scanner, StopsAtDiagnosticLimit) {
+    EXPECT_EQ(scan_errors("$\n$\n$\n$\n", 2).size(), 2);
+
+    DiagnosticEngine diagnostics(1);
+    const auto tokens = Scanner("$\nvalue\n", diagnostics).tokenize();
+    ASSERT_EQ(tokens.size(), 1);
+    EXPECT_EQ(tokens.front().type(), Token::Type::EndOfFile);
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "front/simd.hpp"
+
+using namespace arkoi::front;
+
+static const std::string INPUT =
+    "    fun main_Function42() @u64: # a comment that spans beyond a couple of vector widths\n"
+    "        return 0x1F + some_long_identifier_name_with_digits_0123456789 \xC3\xA9 ~[`{@/:\n"
+    "\n"
+    "                                                                  trailing";
+
+template<typename Predicate>
+static const char *reference(const char *begin, const char *end, Predicate predicate) {
+    return std::find_if_not(begin, end, predicate);
+}
+
+// Every start and end offset is checked, thus both the vectorized loops and the scalar tails are covered.
+template<typename Skip, typename Predicate>
+static void expect_matches_reference(Skip skip, Predicate predicate) {
+    const auto *data = INPUT.data();
+
+    for (size_t start = 0; start <= INPUT.size(); start++) {
+        for (size_t end = start; end <= INPUT.size(); end++) {
+            const auto *expected = reference(data + start, data + end, predicate);
+            ASSERT_EQ(skip(data + start, data + end), expected) << "start=" << start << ", end=" << end;
+        }
+    }
+}
+
+TEST(Simd, SkipSpaces) {
+    expect_matches_reference(simd::skip_spaces, [](char input) { return input == ' '; });
+}
+
+TEST(Simd, SkipIdentifier) {
+    expect_matches_reference(simd::skip_identifier, [](char input) {
+        return (input >= 'a' && input <= 'z') || (input >= 'A' && input <= 'Z') ||
+               (input >= '0' && input <= '9') || input == '_';
+    });
+}
+
+TEST(Simd, FindNewline) {
+    expect_matches_reference(simd::find_newline, [](char input) { return input != '\n'; });
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
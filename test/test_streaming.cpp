@@ -0,0 +1,157 @@
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "front/parser.hpp"
+#include "front/scanner.hpp"
+#include "il/generator.hpp"
+#include "il/il_printer.hpp"
+#include "opt/constant_folding.hpp"
+#include "opt/constant_propagation.hpp"
+#include "opt/dead_code_elimination.hpp"
+#include "opt/pass.hpp"
+#include "opt/simplify_cfg.hpp"
+#include "sem/fused_resolver.hpp"
+#include "sem/name_resolver.hpp"
+#include "sem/type_resolver.hpp"
+#include "x86_64/generator.hpp"
+
+using namespace arkoi;
+
+struct Output {
+    std::string il, assembly;
+};
+
+static opt::PassManager make_manager() {
+    opt::PassManager manager;
+    manager.add<opt::ConstantFolding>();
+    manager.add<opt::ConstantPropagation>();
+    manager.add<opt::DeadCodeElimination>();
+    manager.add<opt::SimplifyCFG>();
+    return manager;
+}
+
+static Output compile_batch(const std::string &source) {
+    ast::AstArena arena;
+    sem::SymbolArena symbols;
+    DiagnosticEngine diagnostics;
+
+    front::Scanner scanner(source, diagnostics);
+    front::Parser parser(scanner, arena, diagnostics);
+    auto program = parser.parse_program();
+    EXPECT_FALSE(parser.has_failed());
+
+    EXPECT_FALSE(sem::NameResolver::resolve(program, symbols, diagnostics).has_failed());
+    EXPECT_FALSE(sem::TypeResolver::resolve(program, arena, symbols, diagnostics).has_failed());
+
+    auto manager = make_manager();
+    auto module = il::Generator::generate(program, symbols);
+    manager.run(module);
+
+    return {il::ILPrinter::print(module).str(), x86_64::Generator(module).output().str()};
+}
+
+static Output compile_stream(const std::string &source) {
+    sem::SymbolArena symbols;
+    DiagnosticEngine diagnostics;
+
+    auto parts = front::Parser::parse_parts(source, diagnostics);
+    EXPECT_TRUE(parts.has_value());
+    if (!parts) return {};
+
+    sem::FusedResolver resolver(symbols, diagnostics);
+    for (auto &part: *parts) resolver.declare(part.program, *part.arena);
+
+    auto manager = make_manager();
+    il::Generator il_generator(symbols);
+    x86_64::Generator generator;
+
+    Output output;
+    for (auto &part: *parts) {
+        resolver.define(part.program, *part.arena);
+        EXPECT_FALSE(resolver.has_failed());
+
+        for (const auto &item: part.program.statements()) {
+            auto &function = il_generator.lower(*ast::node_cast<ast::Function>(item));
+            manager.run(function);
+            output.il += il::ILPrinter::print(function).str();
+
+            generator.generate(function);
+            output.assembly += generator.take_text().str();
+        }
+
+        // The following parts only depend on the prototype symbols, not on the nodes.
+        part.arena.reset();
+    }
+    output.assembly += generator.take_data().str();
+
+    resolver.finish();
+    EXPECT_FALSE(resolver.has_failed());
+
+    return output;
+}
+
+TEST(Streaming, EqualsBatchOutput) {
+    std::string source;
+    for (size_t index = 0; index < 16; index++) {
+        source += "fun function_" + std::to_string(index) + "(a @s32, b @f64) @f64:\n";
+        source += "    c @s32 = 2 * 3 + a\n";
+        source += "    if c > 7:\n";
+        source += "        return b * 1.5\n";
+        if (index != 0) source += "    return function_" + std::to_string(index - 1) + "(c, b + 0.25)\n";
+        else source += "    return b\n";
+        source += "\n";
+    }
+    source += "fun main() @f64:\n    return function_15(1, 2.0)\n";
+
+    const auto batch = compile_batch(source);
+    const auto stream = compile_stream(source);
+
+    EXPECT_EQ(stream.il, batch.il);
+    EXPECT_EQ(stream.assembly, batch.assembly);
+}
+
+TEST(Streaming, ParsesAPartPerFunction) {
+    const std::string source = "fun a() @s32:\n    return 1\n\nfun b() @s32:\n    return a()\n";
+
+    DiagnosticEngine diagnostics;
+    const auto parts = front::Parser::parse_parts(source, diagnostics);
+    ASSERT_TRUE(parts.has_value());
+    ASSERT_EQ(parts->size(), 2);
+
+    for (const auto &part: *parts) {
+        EXPECT_EQ(part.program.statements().size(), 1);
+        EXPECT_GT(part.arena->allocated(), 0);
+    }
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
@@ -0,0 +1,83 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "utils/string_interner.hpp"
+
+TEST(StringInterner, SameStringSameId) {
+    StringInterner interner;
+
+    const auto first = interner.intern("main");
+    const auto second = interner.intern(std::string("ma") + "in");
+    const auto other = interner.intern("main_entry");
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(interner.lookup(first), "main");
+    EXPECT_EQ(interner.lookup(other), "main_entry");
+}
+
+TEST(StringInterner, EmptyStringIsZero) {
+    StringInterner interner;
+
+    EXPECT_EQ(interner.intern(""), 0);
+    EXPECT_EQ(Name().view(), "");
+}
+
+TEST(StringInterner, ConcurrentInterning) {
+    static constexpr size_t THREADS = 8, NAMES = 512;
+
+    StringInterner interner;
+
+    std::vector<std::vector<uint32_t>> ids(THREADS);
+    std::vector<std::thread> threads;
+    for (size_t thread = 0; thread < THREADS; thread++) {
+        threads.emplace_back([&, thread] {
+            for (size_t index = 0; index < NAMES; index++) {
+                ids[thread].push_back(interner.intern("name_" + std::to_string(index)));
+            }
+        });
+    }
+
+    for (auto &thread: threads) thread.join();
+
+    // The empty string and every distinct name exactly once.
+    EXPECT_EQ(interner.size(), NAMES + 1);
+    for (size_t thread = 1; thread < THREADS; thread++) EXPECT_EQ(ids[thread], ids[0]);
+    for (size_t index = 0; index < NAMES; index++) {
+        EXPECT_EQ(interner.lookup(ids[0][index]), "name_" + std::to_string(index));
+    }
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
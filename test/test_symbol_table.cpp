@@ -0,0 +1,104 @@
+#include "gtest/gtest.h"
+
+#include "sem/symbol_table.hpp"
+
+using namespace arkoi::sem;
+
+TEST(SymbolTable, ShadowsOuterScopes) {
+    SymbolArena symbols;
+    SymbolTable table(symbols);
+    const Name name("value");
+
+    table.enter_scope();
+    const auto outer = table.insert<Variable>(name);
+    ASSERT_TRUE(outer.has_value());
+    EXPECT_EQ(table.insert<Variable>(name), std::nullopt);
+
+    table.enter_scope();
+    const auto inner = table.insert<Variable>(name);
+    ASSERT_TRUE(inner.has_value());
+    EXPECT_EQ(table.lookup<Variable>(name), inner);
+
+    table.exit_scope();
+    EXPECT_EQ(table.lookup<Variable>(name), outer);
+
+    table.exit_scope();
+    EXPECT_EQ(table.lookup<Variable>(name), std::nullopt);
+}
+
+TEST(SymbolTable, LooksUpByType) {
+    SymbolArena symbols;
+    SymbolTable table(symbols);
+    const Name name("main");
+
+    table.enter_scope();
+    const auto function = table.insert<Function>(name);
+
+    table.enter_scope();
+    const auto variable = table.insert<Variable>(name);
+
+    EXPECT_EQ(table.lookup<Function>(name), function);
+    EXPECT_EQ(table.lookup<Variable>(name), variable);
+    EXPECT_EQ((table.lookup<Function, Variable>(name)), variable);
+    EXPECT_EQ(table.lookup<Variable>(Name("unknown")), std::nullopt);
+    EXPECT_EQ(symbols.size(), 2);
+}
+
+TEST(SymbolTable, NestsInGlobals) {
+    SymbolArena symbols;
+    SymbolTable globals(symbols);
+    const Name function_name("function"), variable_name("variable");
+
+    globals.enter_scope();
+    const auto function = globals.insert<Function>(function_name);
+    const auto slot = symbols.reserve(2);
+
+    SymbolTable table(symbols, globals, slot);
+    EXPECT_EQ(table.lookup<Function>(function_name), function);
+    EXPECT_EQ(table.lookup<Variable>(variable_name), std::nullopt);
+
+    table.enter_scope();
+    const auto variable = table.insert<Variable>(variable_name);
+    EXPECT_EQ(variable, slot);
+    EXPECT_EQ(table.lookup<Variable>(variable_name), variable);
+
+    const auto shadow = table.insert<Variable>(function_name);
+    ASSERT_TRUE(shadow.has_value());
+    EXPECT_EQ((table.lookup<Function, Variable>(function_name)), shadow);
+
+    table.exit_scope();
+    EXPECT_EQ(table.lookup<Variable>(variable_name), std::nullopt);
+    EXPECT_EQ((table.lookup<Function, Variable>(function_name)), function);
+    EXPECT_EQ(symbols.size(), 3);
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
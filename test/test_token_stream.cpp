@@ -0,0 +1,82 @@
+#include <filesystem>
+
+#include "gtest/gtest.h"
+
+#include "front/scanner.hpp"
+#include "front/source.hpp"
+#include "front/token_stream.hpp"
+
+using namespace arkoi::front;
+
+static const std::string FILES = TEST_PATH "/snapshot/scanner/";
+
+static bool operator==(const Token &lhs, const Token &rhs) {
+    return lhs.type() == rhs.type() && lhs.contents() == rhs.contents() && lhs.offset() == rhs.offset();
+}
+
+TEST(TokenStream, MatchesTokenize) {
+    for (const auto &entry: std::filesystem::directory_iterator(FILES)) {
+        if (entry.path().extension() != ".ark") continue;
+
+        const auto source = Source::map(entry.path());
+
+        DiagnosticEngine diagnostics;
+        auto expected = Scanner(source.data(), diagnostics).tokenize();
+
+        Scanner scanner(source.data(), diagnostics);
+        TokenStream stream(scanner);
+
+        for (const auto &token: expected) {
+            ASSERT_TRUE(stream.peek() == token) << entry.path();
+            ASSERT_TRUE(stream.next() == token) << entry.path();
+        }
+    }
+}
+
+TEST(TokenStream, Lookahead) {
+    TokenStream stream(std::vector<Token>{
+        {Token::Type::Fun, 0, "fun"},
+        {Token::Type::Identifier, 4, "main"},
+        {Token::Type::LParent, 8, "("},
+    });
+
+    EXPECT_EQ(stream.peek(2).type(), Token::Type::LParent);
+    EXPECT_EQ(stream.peek(1).type(), Token::Type::Identifier);
+    EXPECT_EQ(stream.next().type(), Token::Type::Fun);
+    EXPECT_EQ(stream.peek(3).type(), Token::Type::EndOfFile);
+    EXPECT_EQ(stream.next().type(), Token::Type::Identifier);
+    EXPECT_EQ(stream.next().type(), Token::Type::LParent);
+    EXPECT_EQ(stream.next().type(), Token::Type::EndOfFile);
+    EXPECT_EQ(stream.next().type(), Token::Type::EndOfFile);
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================
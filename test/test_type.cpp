@@ -0,0 +1,58 @@
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "sem/type.hpp"
+
+using namespace arkoi::sem;
+
+static_assert(sizeof(Type) == 1);
+static_assert(Type(Integral(Size::DWORD, true)).id() == TypeId::S32);
+static_assert(Type(Integral(Size::BYTE, false)).id() == TypeId::U8);
+static_assert(Type(Floating(Size::QWORD)).id() == TypeId::F64);
+static_assert(Type(TypeId::S16).max() == 32767);
+static_assert(Type(TypeId::F32).register_class() == RegisterClass::Floating);
+
+TEST(Type, InternsEveryPrimitive) {
+    for (size_t index = 0; index < TYPE_INFOS.size(); index++) {
+        const Type type(static_cast<TypeId>(index));
+
+        const auto view = type.visit([](const auto &value) { return Type(value); });
+        EXPECT_EQ(view, type);
+
+        std::stringstream output;
+        output << type;
+        EXPECT_EQ(output.str(), TYPE_INFOS[index].name);
+    }
+}
+
+//==============================================================================
+// BSD 3-Clause License
+//
+// Copyright (c) 2025, Timo Behrend
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// 3. Neither the name of the copyright holder nor the names of its
+//    contributors may be used to endorse or promote products derived from
+//    this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==============================================================================